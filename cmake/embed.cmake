@@ -0,0 +1,59 @@
+# Generates a C++ source embedding binary files and an index to find them by
+# name, run at build time by the custom command in CMakeLists.txt:
+#   cmake -DOUTPUT=<file.cpp> -DASSETS=<a|b|...> -DINCBIN=<ON|OFF>
+#         -P embed.cmake
+# With INCBIN the assembler includes the files as they are, which keeps the
+# build fast. Otherwise they are written out as arrays, for compilers without
+# GNU inline assembly.
+
+string(REPLACE "|" ";" ASSETS "${ASSETS}")
+
+# 16 bytes per line of array
+set(line_pattern "")
+foreach(i RANGE 1 16)
+  string(APPEND line_pattern "0x[0-9a-f][0-9a-f],")
+endforeach()
+
+set(declarations "")
+set(entries "")
+set(count 0)
+foreach(asset IN LISTS ASSETS)
+  get_filename_component(name "${asset}" NAME)
+  file(SIZE "${asset}" size)
+  set(symbol "tetris_asset_${count}")
+
+  if(INCBIN)
+    string(APPEND declarations
+      "__asm__(ASSET_SECTION \".balign 16\\n${symbol}:\\n\"\n"
+      "        \".incbin \\\"${asset}\\\"\\n.byte 0\\n.popsection\\n\");\n"
+      "extern \"C\" const unsigned char ${symbol}[] __asm__(\"${symbol}\");\n\n")
+  else()
+    file(READ "${asset}" hex HEX)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${hex}")
+    string(REGEX REPLACE "(${line_pattern})" "\\1\n    " bytes "${bytes}")
+    string(APPEND declarations
+      "alignas(16) const unsigned char ${symbol}[] = {\n    ${bytes}0};\n\n")
+  endif()
+
+  string(APPEND entries "    {\"${name}\", ${symbol}, ${size}},\n")
+  math(EXPR count "${count} + 1")
+endforeach()
+
+file(WRITE "${OUTPUT}" "// Generated by cmake/embed.cmake, do not edit
+#include \"assets.h\"
+#include <cstddef>
+
+#ifdef _WIN32
+#define ASSET_SECTION \".pushsection .rdata,\\\"dr\\\"\\n\"
+#else
+#define ASSET_SECTION \".pushsection .rodata\\n\"
+#endif
+
+${declarations}namespace Assets {
+
+const Entry INDEX[] = {
+${entries}};
+const std::size_t INDEX_SIZE = ${count};
+
+} // namespace Assets
+")
@@ -0,0 +1,144 @@
+# Profile-guided build of the game, run by the pgo target in CMakeLists.txt:
+#   cmake -DSOURCE_DIR=<repo> -DBINARY_DIR=<dir> [-DGENERATOR=<generator>]
+#         [-DCXX_COMPILER=<compiler>] [-DPREFIX_PATH=<a|b|...>] -P pgo.cmake
+# Builds in BINARY_DIR, all in release:
+#   plain/  without link time optimisation
+#   lto/    with it
+#   pgo/    instrumented, trained with `tetris_bench train`, then rebuilt in
+#           place with the profile: GCC names the profile after the objects
+# then benchmarks the three of them RUNS times into
+# BINARY_DIR/<build>-<run>.json and prints the medians.
+cmake_minimum_required(VERSION 3.19)
+
+# Not train, which the profile was recorded from
+set(BENCHMARKS sim_steps virtual_10min alloc_frame render_game render_hud
+    particles_10k)
+set(BUILDS plain lto pgo)
+set(RUNS 7)
+set(profile ${BINARY_DIR}/profile)
+
+function(run)
+  execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    string(REPLACE ";" " " command "${ARGN}")
+    message(FATAL_ERROR "Failed: ${command}")
+  endif()
+endfunction()
+
+function(build name)
+  set(arguments -S ${SOURCE_DIR} -B ${BINARY_DIR}/${name}
+      -DCMAKE_BUILD_TYPE=Release ${ARGN})
+  if(GENERATOR)
+    list(APPEND arguments -G ${GENERATOR})
+  endif()
+  if(CXX_COMPILER)
+    list(APPEND arguments -DCMAKE_CXX_COMPILER=${CXX_COMPILER})
+  endif()
+  if(PREFIX_PATH)
+    # Escaped to stay one argument, which run() would split again
+    string(REPLACE "|" "\\;" prefix_path "${PREFIX_PATH}")
+    list(APPEND arguments "-DCMAKE_PREFIX_PATH=${prefix_path}")
+  endif()
+  execute_process(COMMAND ${CMAKE_COMMAND} ${arguments}
+                  RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to configure ${name}")
+  endif()
+  run(${CMAKE_COMMAND} --build ${BINARY_DIR}/${name} --config Release
+      --parallel)
+endfunction()
+
+# Multi-configuration generators add a directory per configuration
+function(find_bench name result)
+  set(bench ${BINARY_DIR}/${name}/tetris_bench)
+  if(NOT EXISTS ${bench})
+    set(bench ${BINARY_DIR}/${name}/Release/tetris_bench)
+  endif()
+  set(${result} ${bench} PARENT_SCOPE)
+endfunction()
+
+build(plain -DTETRIS_LTO=OFF -DTETRIS_PGO=OFF)
+build(lto -DTETRIS_LTO=ON -DTETRIS_PGO=OFF)
+
+file(REMOVE_RECURSE ${profile})
+build(pgo -DTETRIS_LTO=ON -DTETRIS_PGO=GENERATE -DTETRIS_PGO_DIR=${profile})
+find_bench(pgo bench)
+message(STATUS "Training")
+run(${bench} train)
+
+# Clang writes raw profiles to merge, GCC what it reads
+file(GLOB raw_profiles ${profile}/*.profraw)
+if(raw_profiles)
+  get_filename_component(compiler_dir "${CXX_COMPILER}" DIRECTORY)
+  find_program(PROFDATA NAMES llvm-profdata HINTS ${compiler_dir})
+  if(NOT PROFDATA AND APPLE)
+    execute_process(COMMAND xcrun -f llvm-profdata
+                    OUTPUT_VARIABLE PROFDATA OUTPUT_STRIP_TRAILING_WHITESPACE)
+  endif()
+  if(NOT PROFDATA)
+    message(FATAL_ERROR "llvm-profdata is needed to merge the Clang profile")
+  endif()
+  run(${PROFDATA} merge -output=${profile}/tetris.profdata ${raw_profiles})
+endif()
+
+build(pgo -DTETRIS_PGO=USE)
+
+# The builds take turns, RUNS times, so that a slower spell of the machine
+# does not fall on one of them only. Run to run, a benchmark easily moves
+# by a quarter: a single run shows nothing.
+foreach(run RANGE 1 ${RUNS})
+  foreach(name IN LISTS BUILDS)
+    find_bench(${name} bench)
+    message(STATUS "Benchmarking ${name}, run ${run} of ${RUNS}")
+    execute_process(COMMAND ${bench} ${BENCHMARKS}
+                    OUTPUT_FILE ${BINARY_DIR}/${name}-${run}.json
+                    RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+      message(FATAL_ERROR "Benchmarks of ${name} failed")
+    endif()
+    file(READ ${BINARY_DIR}/${name}-${run}.json json_${name}_${run})
+  endforeach()
+endforeach()
+
+# Of a list of numbers, LESS compares them as such
+function(median values result)
+  set(sorted)
+  foreach(value IN LISTS values)
+    set(index 0)
+    foreach(other IN LISTS sorted)
+      if(other LESS value)
+        math(EXPR index "${index} + 1")
+      endif()
+    endforeach()
+    list(LENGTH sorted length)
+    if(index EQUAL length)
+      list(APPEND sorted ${value})
+    else()
+      list(INSERT sorted ${index} ${value})
+    endif()
+  endforeach()
+  list(LENGTH sorted length)
+  math(EXPR middle "${length} / 2")
+  list(GET sorted ${middle} value)
+  set(${result} ${value} PARENT_SCOPE)
+endfunction()
+
+# Median milliseconds per iteration, one line per benchmark
+string(JSON count LENGTH "${json_plain_1}" benchmarks)
+math(EXPR last "${count} - 1")
+foreach(i RANGE ${last})
+  string(JSON benchmark GET "${json_plain_1}" benchmarks ${i} name)
+  set(line "${benchmark}:")
+  foreach(name IN LISTS BUILDS)
+    set(values)
+    foreach(run RANGE 1 ${RUNS})
+      string(JSON ms GET "${json_${name}_${run}}" benchmarks ${i}
+             ms_per_iteration)
+      list(APPEND values ${ms})
+    endforeach()
+    median("${values}" ms)
+    string(APPEND line " ${name} ${ms}")
+  endforeach()
+  message(STATUS "${line} ms, median of ${RUNS}")
+endforeach()
+message(STATUS "Profile-guided game: ${BINARY_DIR}/pgo")
@@ -0,0 +1,158 @@
+#include "alloc.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#define ALLOC_HAS_DLADDR
+#endif
+
+namespace Alloc {
+
+// Constant initialised: usable from the very first allocation, before any
+// constructor has run
+struct Shared {
+  std::atomic<std::uint64_t> allocations = 0;
+  std::atomic<std::uint64_t> bytes = 0;
+};
+
+struct Site {
+  std::atomic<const void *> address = nullptr;
+  Shared counters;
+};
+
+Shared shared;
+thread_local Counters localCounters;
+
+std::atomic<bool> isTrackingSites = false;
+std::array<Site, SITES> sites;
+// Allocations of the sites that did not fit
+Shared unattributed;
+
+Counters operator+(Counters a, Counters b) {
+  return {a.allocations + b.allocations, a.bytes + b.bytes};
+}
+
+Counters operator-(Counters a, Counters b) {
+  return {a.allocations - b.allocations, a.bytes - b.bytes};
+}
+
+Counters load(const Shared &counters) {
+  return {counters.allocations.load(std::memory_order_relaxed),
+          counters.bytes.load(std::memory_order_relaxed)};
+}
+
+void add(Shared &counters, std::size_t size) {
+  counters.allocations.fetch_add(1, std::memory_order_relaxed);
+  counters.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+Counters total() { return load(shared); }
+
+Counters local() { return localCounters; }
+
+void trackSites(bool enabled) {
+  isTrackingSites.store(enabled, std::memory_order_relaxed);
+}
+
+void clearSites() {
+  for (auto &site : sites) {
+    site.counters.allocations.store(0, std::memory_order_relaxed);
+    site.counters.bytes.store(0, std::memory_order_relaxed);
+  }
+  unattributed.allocations.store(0, std::memory_order_relaxed);
+  unattributed.bytes.store(0, std::memory_order_relaxed);
+}
+
+// Open addressing, a site keeps its slot once it has claimed it
+Shared &slot(const void *address) {
+  auto hash = std::uintptr_t(address) * UINT64_C(0x9E3779B97F4A7C15);
+  std::size_t index = (hash >> 32) % SITES;
+
+  for (std::size_t probe = 0; probe < SITES; ++probe) {
+    Site &site = sites[(index + probe) % SITES];
+    const void *current = site.address.load(std::memory_order_acquire);
+    if (current == nullptr &&
+        site.address.compare_exchange_strong(current, address,
+                                             std::memory_order_acq_rel)) {
+      return site.counters;
+    }
+    if (current == address) {
+      return site.counters;
+    }
+  }
+  return unattributed;
+}
+
+void count(std::size_t size, const void *site) {
+  localCounters.allocations += 1;
+  localCounters.bytes += size;
+  add(shared, size);
+
+  if (isTrackingSites.load(std::memory_order_relaxed)) {
+    add(site != nullptr ? slot(site) : unattributed, size);
+  }
+}
+
+void writeSite(std::ostream &out, const void *address, Counters counters) {
+  out << "{\"address\": \"" << address << "\"";
+#ifdef ALLOC_HAS_DLADDR
+  Dl_info info;
+  if (address != nullptr && dladdr(address, &info) != 0) {
+    auto offset = std::uintptr_t(address) - std::uintptr_t(info.dli_fbase);
+    out << ", \"module\": \"" << info.dli_fname << "\", \"offset\": \"0x"
+        << std::hex << offset << std::dec << "\"";
+    if (info.dli_sname != nullptr) {
+      // Allocated with malloc, which is not counted
+      int status = 0;
+      char *name =
+          abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+      out << ", \"symbol\": \"" << (status == 0 ? name : info.dli_sname)
+          << "\"";
+      std::free(name);
+    }
+  }
+#endif
+  out << ", \"allocations\": " << counters.allocations
+      << ", \"bytes\": " << counters.bytes << "}";
+}
+
+void writeSites(std::ostream &out, std::size_t count) {
+  struct Entry {
+    const void *address;
+    Counters counters;
+  };
+  std::vector<Entry> entries;
+  for (const auto &site : sites) {
+    Counters counters = load(site.counters);
+    if (counters.allocations > 0) {
+      entries.push_back({site.address.load(std::memory_order_acquire),
+                         counters});
+    }
+  }
+  Counters others = load(unattributed);
+  if (others.allocations > 0) {
+    entries.push_back({nullptr, others});
+  }
+
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry &left, const Entry &right) {
+              return left.counters.allocations > right.counters.allocations;
+            });
+  entries.resize(std::min(entries.size(), count));
+
+  out << "[";
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    out << (i == 0 ? "" : ", ");
+    writeSite(out, entries[i].address, entries[i].counters);
+  }
+  out << "]";
+}
+
+} // namespace Alloc
@@ -0,0 +1,46 @@
+#ifndef ALLOC_H
+#define ALLOC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// Counts the allocations made through the global operator new, replaced in
+// alloc_hooks.cpp. Libraries calling malloc directly are not seen. Frames
+// played in the game are expected not to allocate, see the alloc_frame
+// benchmark.
+namespace Alloc {
+
+struct Counters {
+  std::uint64_t allocations = 0;
+  std::uint64_t bytes = 0;
+};
+
+Counters operator+(Counters a, Counters b);
+Counters operator-(Counters a, Counters b);
+
+// Call sites attributed, the allocations of the others are only counted
+constexpr std::size_t SITES = 1024;
+
+// Since the start of the process, all threads together
+Counters total();
+
+// Made by the calling thread, cheap enough to read around every step
+Counters local();
+
+// Attributing each allocation to its caller costs a lookup in a table shared
+// by all threads, so it is only done while enabled
+void trackSites(bool enabled);
+void clearSites();
+
+// The `count` sites with the most allocations as a JSON array. Names are
+// only resolved when the executable exports its symbols, the offset is for
+// addr2line otherwise.
+void writeSites(std::ostream &out, std::size_t count);
+
+// From the hooks, `site` is the return address of operator new
+void count(std::size_t size, const void *site);
+
+} // namespace Alloc
+
+#endif // !ALLOC_H
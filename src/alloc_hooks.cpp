@@ -0,0 +1,128 @@
+#include "alloc.h"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions to count what goes through them,
+// see Alloc. Only linked into executables: a program has one of each.
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define ALLOC_CALLER _ReturnAddress()
+#define ALLOC_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#define ALLOC_CALLER __builtin_return_address(0)
+#define ALLOC_NOINLINE __attribute__((noinline))
+#else
+#define ALLOC_CALLER nullptr
+#define ALLOC_NOINLINE
+#endif
+
+namespace {
+
+void *allocate(std::size_t size, const void *site) {
+  Alloc::count(size, site);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void *allocateAligned(std::size_t size, std::align_val_t align,
+                      const void *site) {
+  Alloc::count(size, site);
+  auto alignment = std::size_t(align);
+#ifdef _WIN32
+  return _aligned_malloc(size == 0 ? 1 : size, alignment);
+#else
+  // aligned_alloc only takes multiples of the alignment
+  size = (size + alignment - 1) / alignment * alignment;
+  return std::aligned_alloc(alignment, size == 0 ? alignment : size);
+#endif
+}
+
+void deallocateAligned(void *pointer) {
+#ifdef _WIN32
+  _aligned_free(pointer);
+#else
+  std::free(pointer);
+#endif
+}
+
+void *orThrow(void *pointer) {
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+} // namespace
+
+ALLOC_NOINLINE void *operator new(std::size_t size) {
+  return orThrow(allocate(size, ALLOC_CALLER));
+}
+
+ALLOC_NOINLINE void *operator new[](std::size_t size) {
+  return orThrow(allocate(size, ALLOC_CALLER));
+}
+
+ALLOC_NOINLINE void *operator new(std::size_t size,
+                                  const std::nothrow_t &) noexcept {
+  return allocate(size, ALLOC_CALLER);
+}
+
+ALLOC_NOINLINE void *operator new[](std::size_t size,
+                                    const std::nothrow_t &) noexcept {
+  return allocate(size, ALLOC_CALLER);
+}
+
+ALLOC_NOINLINE void *operator new(std::size_t size, std::align_val_t align) {
+  return orThrow(allocateAligned(size, align, ALLOC_CALLER));
+}
+
+ALLOC_NOINLINE void *operator new[](std::size_t size, std::align_val_t align) {
+  return orThrow(allocateAligned(size, align, ALLOC_CALLER));
+}
+
+ALLOC_NOINLINE void *operator new(std::size_t size, std::align_val_t align,
+                                  const std::nothrow_t &) noexcept {
+  return allocateAligned(size, align, ALLOC_CALLER);
+}
+
+ALLOC_NOINLINE void *operator new[](std::size_t size, std::align_val_t align,
+                                    const std::nothrow_t &) noexcept {
+  return allocateAligned(size, align, ALLOC_CALLER);
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+void operator delete[](void *pointer) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+void operator delete[](void *pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+  std::free(pointer);
+}
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+  deallocateAligned(pointer);
+}
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+  deallocateAligned(pointer);
+}
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept {
+  deallocateAligned(pointer);
+}
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept {
+  deallocateAligned(pointer);
+}
+void operator delete(void *pointer, std::align_val_t,
+                     const std::nothrow_t &) noexcept {
+  deallocateAligned(pointer);
+}
+void operator delete[](void *pointer, std::align_val_t,
+                       const std::nothrow_t &) noexcept {
+  deallocateAligned(pointer);
+}
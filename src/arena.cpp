@@ -0,0 +1,59 @@
+#include "arena.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+namespace Arena {
+
+T init(std::size_t capacity) {
+  T t = T{};
+  t.memory.reset(new std::byte[capacity]);
+  t.capacity = capacity;
+#ifndef NDEBUG
+  std::memset(t.memory.get(), POISON, capacity);
+#endif
+  return t;
+}
+
+void *allocate(T &t, std::size_t size, std::size_t alignment) {
+  if (alignment > alignof(std::max_align_t)) {
+    std::cerr << "Error: arena alignment " << alignment << " is too large"
+              << std::endl;
+    throw std::invalid_argument("alignment");
+  }
+
+  std::size_t start = (t.used + alignment - 1) / alignment * alignment;
+  if (start + size <= t.capacity) {
+    t.used = start + size;
+    return t.memory.get() + start;
+  }
+
+  t.overflow.push_back(std::unique_ptr<std::byte[]>(new std::byte[size]));
+  t.overflowBytes += size;
+  return t.overflow.back().get();
+}
+
+std::size_t size(const T &t) { return t.used + t.overflowBytes; }
+
+void reset(T &t) {
+  t.highWater = std::max(t.highWater, size(t));
+  bool grows = !t.overflow.empty();
+
+  if (grows) {
+    // Once, with some room for the alignment padding and the next peak
+    t.capacity = t.highWater + t.highWater / 2;
+    t.memory.reset(new std::byte[t.capacity]);
+    t.overflow.clear();
+    t.overflowBytes = 0;
+  }
+#ifndef NDEBUG
+  // What was handed out, or the whole new block
+  std::memset(t.memory.get(), POISON, grows ? t.capacity : t.used);
+#endif
+  t.used = 0;
+}
+
+} // namespace Arena
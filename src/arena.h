@@ -0,0 +1,51 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Bump allocator for what only lives until the end of a frame: allocating
+// moves a pointer, everything is released at once by reset.
+namespace Arena {
+
+// Written over what reset releases in debug builds, so that anything still
+// pointing there reads garbage instead of the previous frame
+constexpr unsigned char POISON = 0xCD;
+
+// Move only. Pointers into it stay valid until the next reset.
+struct T {
+  std::unique_ptr<std::byte[]> memory;
+  std::size_t capacity = 0;
+  std::size_t used = 0;
+  // Most used between two resets since init
+  std::size_t highWater = 0;
+  // What did not fit, from the heap until the next reset, which then grows
+  // the memory instead
+  std::vector<std::unique_ptr<std::byte[]>> overflow;
+  std::size_t overflowBytes = 0;
+};
+
+T init(std::size_t capacity);
+
+// Up to the alignment of std::max_align_t
+void *allocate(T &t, std::size_t size, std::size_t alignment);
+
+// `count` default constructed objects, never destroyed
+template <typename U> U *make(T &t, std::size_t count) {
+  static_assert(std::is_trivially_destructible_v<U>,
+                "arena objects are never destroyed");
+  auto *first = static_cast<U *>(allocate(t, sizeof(U) * count, alignof(U)));
+  std::uninitialized_default_construct_n(first, count);
+  return first;
+}
+
+// Used since the last reset
+std::size_t size(const T &t);
+
+void reset(T &t);
+
+} // namespace Arena
+
+#endif // !ARENA_H
@@ -0,0 +1,17 @@
+#include "assets.h"
+#include <iostream>
+#include <stdexcept>
+
+namespace Assets {
+
+std::span<const unsigned char> get(std::string_view name) {
+  for (std::size_t i = 0; i < INDEX_SIZE; ++i) {
+    if (name == INDEX[i].name) {
+      return {INDEX[i].data, INDEX[i].size};
+    }
+  }
+  std::cerr << "Missing asset: " << name << std::endl;
+  throw std::invalid_argument("missing asset");
+}
+
+} // namespace Assets
@@ -0,0 +1,29 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace Assets {
+
+constexpr std::string_view FONT = "ARCADECLASSIC.TTF";
+constexpr std::string_view MUSIC = "tetris-theme.ogg";
+
+// A file embedded at build time, followed by a zero byte
+struct Entry {
+  const char *name;
+  const unsigned char *data;
+  std::size_t size;
+};
+
+// Generated in the build directory by cmake/embed.cmake
+extern const Entry INDEX[];
+extern const std::size_t INDEX_SIZE;
+
+// Throws std::invalid_argument when nothing was embedded under that name
+std::span<const unsigned char> get(std::string_view name);
+
+} // namespace Assets
+
+#endif // !ASSETS_H
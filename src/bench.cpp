@@ -0,0 +1,1091 @@
+#include "alloc.h"
+#include "bot.h"
+#include "clock.h"
+#include "constants.h"
+#include "game.h"
+#include "grid.h"
+#include "hud.h"
+#include "keys.h"
+#include "menu.h"
+#include "latency.h"
+#include "loader.h"
+#include "overlay.h"
+#include "particles.h"
+#include "pool.h"
+#include "render.h"
+#include "scheduler.h"
+#include "snapshot.h"
+#include "spectator.h"
+#include "state.h"
+#include "wall.h"
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Offscreen benchmarks, results are printed as JSON on stdout.
+// Usage: tetris_bench [--position=PATH] [name...] to only run some of them.
+// The simulation benchmarks start from the game saved at PATH, see Snapshot.
+// The latency benchmarks open a window, they only run when asked for by name
+// like startup and train. Exits with 1 when alloc_frame finds frames of
+// gameplay that allocate, when spectator_stream goes over its bandwidth,
+// when virtual_10min or snapshot_load play differently than they should, or
+// when rotation_kicks finds a wrong turn.
+
+namespace {
+
+struct Result {
+  std::string name;
+  int iterations = 0;
+  double milliseconds = 0.0; // per iteration
+  Render::Stats render;      // of the last frame, when something was drawn
+  std::vector<std::pair<std::string, double>> metrics;
+};
+
+void writeJson(const Result &result, std::ostream &out) {
+  out << "    {\"name\": \"" << result.name << "\""
+      << ", \"iterations\": " << result.iterations
+      << ", \"ms_per_iteration\": " << result.milliseconds
+      << ", \"render\": ";
+  Render::writeJson(result.render, out);
+  for (const auto &[key, value] : result.metrics) {
+    out << ", \"" << key << "\": " << value;
+  }
+  out << "}";
+}
+
+Result renderFrames(const std::string &name, sf::RenderTexture &texture,
+                    int frames, const std::function<void(Render::T &)> &draw) {
+  Render::T target = Render::init(texture);
+  sf::Clock clock;
+
+  for (int i = 0; i < frames; ++i) {
+    texture.clear(COLOR_BACKGROUND);
+    draw(target);
+    texture.display();
+    Render::endFrame(target);
+  }
+
+  Result result;
+  result.name = name;
+  result.iterations = frames;
+  result.milliseconds = clock.getElapsedTime().asSeconds() * 1000.0 / frames;
+  result.render = target.last;
+  return result;
+}
+
+bool isSelected(const std::vector<std::string> &filters,
+                const std::string &name) {
+  if (filters.empty()) {
+    return true;
+  }
+  for (const auto &filter : filters) {
+    if (name.find(filter) != std::string::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isExplicitlySelected(const std::vector<std::string> &filters,
+                          const std::string &name) {
+  return !filters.empty() && isSelected(filters, name);
+}
+
+// Injects key presses at random times into the real main loop and measures
+// how long they take to reach the screen
+Result measureLatency(Scheduler::Policy policy) {
+  constexpr int presses = 120;
+
+  sf::RenderWindow window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT),
+                          "Tetris latency");
+  Game::T game;
+  Game::Options options;
+  options.policy = policy;
+  options.sound = false;
+  Game::init(game, window, options);
+  Loader::wait(game.loader);
+  game.state.name = State::Name::PLAYING;
+  game.state.speed = Menu::getSpeed(game.menu);
+
+  std::minstd_rand gen;
+  std::uniform_int_distribution<int> interval(50, 150);
+  sf::Time at = Latency::now() + sf::milliseconds(500);
+
+  for (int i = 0; i < presses; ++i) {
+    sf::Event event;
+    event.type = sf::Event::KeyPressed;
+    event.key.code = i % 2 ? sf::Keyboard::Left : sf::Keyboard::Right;
+    game.script.push_back({at, event});
+
+    event.type = sf::Event::KeyReleased;
+    game.script.push_back({at + sf::milliseconds(30), event});
+
+    at += sf::milliseconds(interval(gen));
+  }
+
+  int frames = 0;
+  sf::Clock clock;
+  while (window.isOpen() && game.scriptPosition < game.script.size()) {
+    Game::frame(game);
+    frames += 1;
+  }
+  window.close();
+  Game::stop(game);
+
+  Result result;
+  result.name = std::string("latency_") + Scheduler::name(policy);
+  result.iterations = frames;
+  result.milliseconds = clock.getElapsedTime().asSeconds() * 1000.0 / frames;
+  result.render = game.target.last;
+  result.metrics.push_back({"samples", double(game.latency.samples)});
+  result.metrics.push_back({"p50_ms", Latency::percentile(game.latency, .5f)});
+  result.metrics.push_back(
+      {"p99_ms", Latency::percentile(game.latency, .99f)});
+  result.metrics.push_back(
+      {"dropped_ms", game.droppedTime.asMicroseconds() / 1000.0});
+  result.metrics.push_back({"cpu", game.scheduler.utilisation});
+  return result;
+}
+
+// From the start of the measure to the window, the first frame and the
+// menu, like main does
+Result measureStartup() {
+  sf::Time start = Latency::now();
+  sf::Clock clock;
+
+  Game::T game;
+  Loader::start(game.loader);
+  sf::RenderWindow window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT),
+                          "Tetris startup");
+  Game::Options options;
+  options.sound = false;
+  Game::init(game, window, options);
+
+  int frames = 0;
+  while (window.isOpen() && !game.isLoaded) {
+    Game::frame(game);
+    frames += 1;
+  }
+  // The first frame with the menu
+  Game::frame(game);
+  frames += 1;
+  window.close();
+  Game::stop(game);
+
+  Result result;
+  result.name = "startup";
+  result.iterations = frames;
+  result.milliseconds = clock.getElapsedTime().asSeconds() * 1000.0 / frames;
+  result.render = game.target.last;
+  result.metrics.push_back(
+      {"window_ms", (game.startup.window - start).asMicroseconds() / 1000.0});
+  result.metrics.push_back(
+      {"first_frame_ms",
+       (game.startup.firstFrame - start).asMicroseconds() / 1000.0});
+  result.metrics.push_back(
+      {"assets_ms", (game.startup.assets - start).asMicroseconds() / 1000.0});
+  return result;
+}
+
+// A new game right after the game over, time goes on
+template <typename U> U playAgain(const U &state) {
+  U next = State::init<U>(state.seed + 1);
+  next.name = State::Name::PLAYING;
+  next.tick = state.tick;
+  next.time = state.time;
+  next.startTime = state.time;
+  return next;
+}
+
+// Before step `i`: shift left and right, hard drop now and then
+void pushScriptedInput(Keys::T &keys, sf::Time time, int i) {
+  auto key = i % 180 == 0 ? sf::Keyboard::Up
+             : i % 20 < 10 ? sf::Keyboard::Left
+                           : sf::Keyboard::Right;
+  if (i % 10 == 0) {
+    Keys::push(keys, {key, true, time, sf::Time::Zero});
+  } else if (i % 10 == 5) {
+    Keys::push(keys, {key, false, time, sf::Time::Zero});
+  }
+}
+
+// Steps `from` to `to` with the scripted input, a new game starts at each
+// game over
+template <typename U> U playScripted(U state, Keys::T &keys, int from, int to) {
+  for (int i = from; i < to; ++i) {
+    pushScriptedInput(keys, state.time, i);
+    state = State::step(state, keys);
+    state.events = State::Events{};
+    if (state.name == State::Name::LOST) {
+      state = playAgain(state);
+    }
+  }
+  return state;
+}
+
+// What the turbo mode is made of: steps without drawing, with some input.
+// `U` is the game or one of its variants, see State.
+template <typename U>
+Result simulateSteps(const std::string &name, int steps,
+                     const std::string &position) {
+  U state = State::init<U>(0);
+  if (!position.empty() && !Snapshot::load(position, state)) {
+    std::cerr << "Cannot start " << name << " from " << position << std::endl;
+  }
+  state.name = State::Name::PLAYING;
+  Keys::T keys;
+  sf::Clock clock;
+  state = playScripted(state, keys, 0, steps);
+
+  double seconds = clock.getElapsedTime().asSeconds();
+  Result result;
+  result.name = name;
+  result.iterations = steps;
+  result.milliseconds = seconds * 1000.0 / steps;
+  result.metrics.push_back({"steps_per_second", steps / seconds});
+  result.metrics.push_back(
+      {"steps_per_frame_budget", steps * turboFrameBudget / seconds});
+  result.metrics.push_back({"state_bytes", double(sizeof(U))});
+  result.metrics.push_back(
+      {"row_bytes", double(sizeof(typename decltype(state.board)::Row))});
+  return result;
+}
+
+// How many boards one core keeps at 60 steps per second, the time of one
+// step of each board being `seconds` for `boardSteps` of them
+double boardsPerCore(double seconds, double boardSteps) {
+  return fixedTimeStep * boardSteps / seconds;
+}
+
+// All the boards of a pool stepped together, with input scripted like
+// sim_steps and shifted from one board to the next. Lost boards restart.
+Result simulatePool(int boards, int steps) {
+  Pool::T pool = Pool::init(boards, 0);
+  sf::Clock clock;
+
+  for (int i = 0; i < steps; ++i) {
+    for (int board = 0; board < boards; ++board) {
+      int tick = i + board;
+      if (tick % 10 == 0) {
+        pool.input[board] = tick % 180 == 0  ? Pool::HARD_DROP
+                            : tick % 20 < 10 ? Pool::LEFT
+                                             : Pool::RIGHT;
+      } else if (tick % 10 == 5) {
+        pool.input[board] = Pool::ROTATE;
+      }
+    }
+    Pool::step(pool);
+    for (int board = 0; board < boards; ++board) {
+      if (pool.lost[board]) {
+        Pool::restart(pool, board);
+      }
+    }
+  }
+
+  double seconds = clock.getElapsedTime().asSeconds();
+  double boardSteps = double(boards) * steps;
+  Result result;
+  result.name = "pool_steps";
+  result.iterations = steps;
+  result.milliseconds = seconds * 1000.0 / steps;
+  result.metrics.push_back({"boards", double(boards)});
+  result.metrics.push_back({"ns_per_board_step", seconds * 1e9 / boardSteps});
+  result.metrics.push_back(
+      {"boards_per_core", boardsPerCore(seconds, boardSteps)});
+  result.metrics.push_back(
+      {"bytes_per_board",
+       double((pool.rows.size() + pool.piece.size() + pool.around.size()) *
+                  sizeof(Pool::Row) +
+              pool.cells.size() + sizeof(Pool::T) / boards) /
+           boards});
+  return result;
+}
+
+// The bot wall without drawing: the bots choose a move for each new piece
+Result simulateWall(int steps) {
+  Wall::T wall = Wall::init(Wall::MAX_BOARDS, 0, 0,
+                            sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
+  sf::Clock clock;
+  std::int64_t pieces = 0;
+  for (int i = 0; i < steps; ++i) {
+    Wall::step(wall);
+    for (int board = 0; board < wall.pool.count; ++board) {
+      pieces += wall.pool.locked[board];
+    }
+  }
+
+  double seconds = clock.getElapsedTime().asSeconds();
+  double boardSteps = double(wall.pool.count) * steps;
+  Result result;
+  result.name = "wall_steps";
+  result.iterations = steps;
+  result.milliseconds = seconds * 1000.0 / steps;
+  result.metrics.push_back({"boards", double(wall.pool.count)});
+  result.metrics.push_back({"ns_per_board_step", seconds * 1e9 / boardSteps});
+  result.metrics.push_back(
+      {"boards_per_core", boardsPerCore(seconds, boardSteps)});
+  result.metrics.push_back({"pieces", double(pieces)});
+  result.metrics.push_back({"games", double(wall.games)});
+  return result;
+}
+
+// The stream a spectator receives from a game played with the input of
+// sim_steps, decoded again to check that the viewer sees the same game.
+// Fails above 1 KB per second of play.
+Result streamSpectator(int steps, bool &isFailed) {
+  State::T state = State::init(0);
+  state.name = State::Name::PLAYING;
+  Keys::T keys;
+  Spectator::Shown sent;
+  std::vector<unsigned char> stream(Spectator::HEADER_SIZE);
+  Spectator::encodeHeader(stream.data());
+  unsigned char buffer[Spectator::MAX_SIZE];
+  // Shorter than the resolution of sf::Clock
+  using Clock = std::chrono::steady_clock;
+  Clock::duration encoding = Clock::duration::zero();
+  int frames = 0;
+  std::size_t largest = 0;
+
+  for (int i = 0; i < steps; ++i) {
+    state = playScripted(state, keys, i, i + 1);
+
+    auto start = Clock::now();
+    std::size_t size = Spectator::encode(sent, state, i + 1, i == 0, buffer);
+    encoding += Clock::now() - start;
+    stream.insert(stream.end(), buffer, buffer + size);
+    frames += size > 0 ? 1 : 0;
+    largest = std::max(largest, size);
+  }
+
+  Spectator::Shown seen;
+  std::size_t position = 0;
+  bool isReproduced =
+      Spectator::decodeHeader(stream.data(), stream.size(), position);
+  while (Spectator::decode(stream.data(), stream.size(), position, seen)) {
+  }
+  isReproduced = isReproduced && position == stream.size() &&
+                 seen.board.cells == state.board.cells &&
+                 seen.position == state.piece.position &&
+                 seen.next == state.piece.next && seen.score == state.score;
+
+  double played = steps * fixedTimeStep;
+  double bytesPerSecond = stream.size() / played;
+  bool isPassed = isReproduced && bytesPerSecond < 1024.0;
+  isFailed = isFailed || !isPassed;
+
+  Result result;
+  result.name = "spectator_stream";
+  result.iterations = steps;
+  result.milliseconds =
+      std::chrono::duration<double, std::milli>(encoding).count() / steps;
+  result.metrics.push_back({"bytes_per_second", bytesPerSecond});
+  result.metrics.push_back({"frames_per_second", frames / played});
+  result.metrics.push_back({"largest_frame", double(largest)});
+  result.metrics.push_back({"reproduced", isReproduced ? 1. : 0.});
+  result.metrics.push_back({"passed", isPassed ? 1. : 0.});
+  return result;
+}
+
+// Drives the simulation like the main loop does, from a virtual clock moved
+// by each of `frameTimes` in turn, with input at fixed virtual times
+State::T playVirtual(sf::Time duration, const std::vector<sf::Time> &frameTimes,
+                     int &games) {
+  constexpr sf::Keyboard::Key inputs[] = {
+      sf::Keyboard::Left, sf::Keyboard::Space, sf::Keyboard::Right,
+      sf::Keyboard::Down, sf::Keyboard::Right, sf::Keyboard::Up};
+  const sf::Time inputInterval = sf::milliseconds(173);
+
+  Clock::T clock = Clock::init(Clock::VIRTUAL);
+  State::T state = State::init(0);
+  state.name = State::Name::PLAYING;
+  Keys::T keys;
+  sf::Time accumulated = sf::Time::Zero;
+  sf::Time nextInput = inputInterval;
+  int input = 0;
+
+  for (std::size_t frame = 0; state.time < duration; ++frame) {
+    Clock::advance(clock, frameTimes[frame % frameTimes.size()]);
+
+    // Pressed then released, as received during the frame
+    for (; nextInput <= Clock::now(clock); nextInput += inputInterval) {
+      auto key = inputs[(input / 2) % std::size(inputs)];
+      Keys::push(keys, {key, input % 2 == 0, nextInput, sf::Time::Zero});
+      input += 1;
+    }
+
+    accumulated += Clock::restart(clock);
+    while (accumulated >= fixedStep && state.time < duration) {
+      state = State::step(state, keys);
+      state.events = State::Events{};
+      accumulated -= fixedStep;
+      if (state.name == State::Name::LOST) {
+        state = playAgain(state);
+        games += 1;
+      }
+    }
+  }
+  return state;
+}
+
+bool isSameGame(const State::T &a, const State::T &b) {
+  return a.tick == b.tick && a.score == b.score && a.lines == b.lines &&
+         a.pieces == b.pieces && a.board.rows == b.board.rows &&
+         a.piece.type == b.piece.type && a.piece.position == b.piece.position &&
+         a.piece.orientation == b.piece.orientation;
+}
+
+// Ten minutes of play in a fraction of that, twice with a different frame
+// pacing: the fixed step must give exactly the same game, fails otherwise
+Result playTenMinutes(bool &isFailed) {
+  sf::Time duration = sf::seconds(600.f);
+  sf::Clock clock;
+
+  int steadyGames = 1;
+  int unevenGames = 1;
+  State::T steady =
+      playVirtual(duration, {sf::microseconds(16667)}, steadyGames);
+  State::T uneven = playVirtual(duration,
+                                {sf::milliseconds(7), sf::milliseconds(3),
+                                 sf::milliseconds(25), sf::milliseconds(11)},
+                                unevenGames);
+
+  double seconds = clock.getElapsedTime().asSeconds();
+  Result result;
+  result.name = "virtual_10min";
+  result.iterations = 2;
+  result.milliseconds = seconds * 1000.0 / 2;
+  result.metrics.push_back({"ticks", double(steady.tick)});
+  result.metrics.push_back({"games", double(steadyGames)});
+  result.metrics.push_back({"speedup", 2 * duration.asSeconds() / seconds});
+  bool isReproduced =
+      steadyGames == unevenGames && isSameGame(steady, uneven);
+  result.metrics.push_back({"reproduced", isReproduced ? 1. : 0.});
+  isFailed = isFailed || !isReproduced;
+  return result;
+}
+
+// A game in progress saved, then loaded back: how long loading takes, and
+// whether the loaded game goes on exactly like the one that was saved, fails
+// otherwise
+Result loadSnapshot(int loads, bool &isFailed) {
+  constexpr int steps = 3000;
+  State::T state = State::init(0);
+  state.name = State::Name::PLAYING;
+  Keys::T keys;
+  state = playScripted(state, keys, 0, steps);
+
+  std::string path =
+      (std::filesystem::temp_directory_path() / "tetris_bench.save").string();
+  bool isReproduced = Snapshot::save(state, path);
+  State::T loaded;
+  sf::Clock clock;
+  for (int i = 0; i < loads; ++i) {
+    isReproduced = Snapshot::load(path, loaded) && isReproduced;
+  }
+  double seconds = clock.getElapsedTime().asSeconds();
+  std::remove(path.c_str());
+
+  // No key is held when saving, both go on with the same input
+  Keys::T loadedKeys;
+  state = playScripted(state, keys, steps, 2 * steps);
+  loaded = playScripted(loaded, loadedKeys, steps, 2 * steps);
+  isReproduced = isReproduced && isSameGame(state, loaded);
+
+  Result result;
+  result.name = "snapshot_load";
+  result.iterations = loads;
+  result.milliseconds = seconds * 1000.0 / loads;
+  result.metrics.push_back(
+      {"bytes", double(Snapshot::encode(state).size())});
+  result.metrics.push_back({"reproduced", isReproduced ? 1. : 0.});
+  isFailed = isFailed || !isReproduced;
+  return result;
+}
+
+// Turns worked out by hand from the kick tables of the Super Rotation
+// System, see Piece
+struct KnownTurn {
+  const char *name;
+  // The bottom rows of the board, # for a locked cell
+  std::array<const char *, 5> rows;
+  int type;
+  int orientation;
+  sf::Vector2i position;
+  int offset;
+  // Where the piece ends up, from the test of the kicks numbered from 1
+  int turned;
+  sf::Vector2i kicked;
+  int test;
+};
+
+const KnownTurn KNOWN_TURNS[] = {
+    {"I R->2 against the left wall: test 3",
+     {"..........", "..........", "..........", "..........", ".........."},
+     1, 2, {-1, 10}, 1, 3, {1, 10}, 3},
+    {"I L->2 against the left wall: test 3",
+     {"..........", "..........", "..........", "..........", ".........."},
+     1, 4, {0, 10}, -1, 3, {1, 10}, 3},
+    {"I L->0 against the right wall: test 3",
+     {"..........", "..........", "..........", "..........", ".........."},
+     1, 4, {9, 10}, 1, 1, {7, 10}, 3},
+    {"I R->0 against the right wall: test 3",
+     {"..........", "..........", "..........", "..........", ".........."},
+     1, 2, {8, 10}, -1, 1, {7, 10}, 3},
+    // Three lines once locked
+    {"T 2->R into a triple: test 4",
+     {"...##.....", "###...####", "####.#####", "####..####", "####.#####"},
+     6, 3, {4, 16}, -1, 2, {4, 18}, 4},
+    // Published (-1, -1), a row down on the board
+    {"L L->2 under a block: test 3",
+     {"..........", "..........", "..#..#....", "..........", ".........."},
+     4, 4, {4, 17}, -1, 3, {3, 18}, 3},
+};
+
+// The known turns through State and the pool, then the pool against State
+// on `stacks` from everywhere a piece fits. Returns the turns that differ.
+template <typename Stack>
+int checkTurns(const std::vector<Stack> &stacks) {
+  int failed = 0;
+  Pool::T pool = Pool::init(1, 0);
+  auto setRows = [&](const Stack &stack) {
+    for (int row = 0; row < NUMROWS; ++row) {
+      pool.rows[Pool::GUTTER + row] =
+          Pool::EMPTY_ROW | (Pool::Row(stack.rows[row]) << Pool::GUTTER);
+    }
+  };
+
+  for (const KnownTurn &known : KNOWN_TURNS) {
+    State::T state = State::init(0);
+    int top = NUMROWS - int(known.rows.size());
+    for (std::size_t row = 0; row < known.rows.size(); ++row) {
+      for (int col = 0; col < NUMCOLS; ++col) {
+        if (known.rows[row][col] == '#') {
+          sf::Vector2i cell(col, top + int(row));
+          state.board = Board::add(state.board, {cell, cell, cell, cell}, 1);
+        }
+      }
+    }
+    state.piece = Piece::set(state.piece, known.orientation, known.type,
+                             known.position);
+    State::T turned = State::rotate(state, known.offset > 0);
+    const Piece::Kicks &kicks =
+        Piece::kicks(known.type, known.orientation, known.offset);
+    int test = 1 + Board::firstFit(state.board,
+                                   Piece::footprint(known.type, known.turned),
+                                   known.position, kicks);
+
+    setRows(state.board);
+    pool.type[0] = std::uint8_t(known.type);
+    int orientation = known.orientation - 1;
+    int x = known.position.x;
+    int y = known.position.y;
+    bool isTurned = Pool::turn(pool, 0, known.offset, orientation, x, y);
+
+    if (test != known.test || turned.piece.orientation != known.turned ||
+        turned.piece.position != known.kicked || !isTurned ||
+        orientation + 1 != known.turned || sf::Vector2i(x, y) != known.kicked) {
+      std::cerr << "rotation_kicks: " << known.name << " gives test " << test
+                << ", " << turned.piece.orientation << " at "
+                << turned.piece.position.x << ", " << turned.piece.position.y
+                << ", in the pool " << orientation + 1 << " at " << x << ", "
+                << y << std::endl;
+      failed += 1;
+    }
+  }
+
+  for (const Stack &stack : stacks) {
+    State::T state = State::init(0);
+    state.board = stack;
+    setRows(stack);
+    for (int type = 1; type <= Piece::TYPES; ++type) {
+      pool.type[0] = std::uint8_t(type);
+      for (int from = 1; from <= 4; ++from) {
+        for (int y = -1; y < NUMROWS; ++y) {
+          for (int x = -1; x <= NUMCOLS; ++x) {
+            if (Board::collides(stack, Piece::blocks(type, from, {x, y}))) {
+              continue;
+            }
+            for (int offset : {1, -1}) {
+              state.piece = Piece::set(state.piece, from, type, {x, y});
+              State::T turned = State::rotate(state, offset > 0);
+              int orientation = from - 1;
+              int poolX = x;
+              int poolY = y;
+              bool isTurned =
+                  Pool::turn(pool, 0, offset, orientation, poolX, poolY);
+              // The pool keeps fewer rows above the grid
+              if (turned.events.rotated &&
+                  turned.piece.position.y < -Pool::SHAPE_TOP - Pool::GUTTER) {
+                continue;
+              }
+              if (isTurned != turned.events.rotated ||
+                  (isTurned && (orientation + 1 != turned.piece.orientation ||
+                                sf::Vector2i(poolX, poolY) !=
+                                    turned.piece.position))) {
+                failed += 1;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return failed;
+}
+
+// Kick series like a search with kicks tries them: every piece turned both
+// ways from everywhere it fits on the boards of a game played with the input
+// of sim_steps. How long a series takes, and how often it is kicked. Fails
+// when a turn of checkTurns differs.
+Result resolveKicks(int rounds, bool &isFailed) {
+  using Stack = decltype(State::T{}.board);
+  // Small, so that the list stays in the caches
+  struct Turn {
+    std::uint16_t board;
+    std::int8_t type;
+    std::int8_t orientation;
+    std::int8_t offset;
+    std::int8_t x;
+    std::int8_t y;
+  };
+
+  constexpr int steps = 6000;
+  constexpr int interval = 60;
+  State::T state = State::init(0);
+  state.name = State::Name::PLAYING;
+  Keys::T keys;
+  std::vector<Stack> boards;
+  for (int i = 0; i < steps; i += interval) {
+    state = playScripted(state, keys, i, i + interval);
+    boards.push_back(state.board);
+  }
+
+  std::vector<Turn> turns;
+  for (std::size_t board = 0; board < boards.size(); ++board) {
+    for (int type = 1; type <= Piece::TYPES; ++type) {
+      for (int orientation = 1; orientation <= 4; ++orientation) {
+        for (int y = -1; y < NUMROWS; ++y) {
+          for (int x = -1; x <= NUMCOLS; ++x) {
+            if (Board::collides(boards[board],
+                                Piece::blocks(type, orientation, {x, y}))) {
+              continue;
+            }
+            for (int offset : {1, -1}) {
+              turns.push_back({std::uint16_t(board), std::int8_t(type),
+                               std::int8_t(orientation), std::int8_t(offset),
+                               std::int8_t(x), std::int8_t(y)});
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Shorter than the resolution of sf::Clock
+  using Clock = std::chrono::steady_clock;
+  auto start = Clock::now();
+  int kicked = 0;
+  int blocked = 0;
+  for (int round = 0; round < rounds; ++round) {
+    for (const Turn &turn : turns) {
+      int orientation = Piece::turn(turn.orientation, turn.offset);
+      int kick = Board::firstFit(
+          boards[turn.board], Piece::footprint(turn.type, orientation),
+          sf::Vector2i(turn.x, turn.y),
+          Piece::kicks(turn.type, turn.orientation, turn.offset));
+      kicked += kick > 0 ? 1 : 0;
+      blocked += kick < 0 ? 1 : 0;
+    }
+  }
+  double series = double(turns.size()) * rounds;
+  double nanoseconds =
+      std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+  Result result;
+  result.name = "rotation_kicks";
+  result.iterations = int(series);
+  result.milliseconds = nanoseconds / 1e6 / series;
+  result.metrics.push_back({"ns_per_series", nanoseconds / series});
+  result.metrics.push_back({"kicked", kicked / series});
+  result.metrics.push_back({"blocked", blocked / series});
+
+  int failed = checkTurns(boards);
+  result.metrics.push_back({"failed_turns", double(failed)});
+  isFailed = isFailed || failed > 0;
+  return result;
+}
+
+// A frame of gameplay must not allocate once warmed up: plays like the main
+// loop does, with line clears, effects and the overlay, and counts the frames
+// that allocated. Their call sites go to stderr.
+Result checkAllocations(sf::RenderTexture &texture, const Grid::T &grid,
+                        const sf::Font &font, bool &isFailed) {
+  constexpr int warmup = 120;
+  constexpr int frames = 3600;
+
+  State::T state = State::init(0);
+  state.name = State::Name::PLAYING;
+  Keys::T keys;
+  Particles::T particles = Particles::init();
+  Hud::T hud;
+  Hud::init(hud, font, HUD_ORIGIN);
+  Overlay::T overlay;
+  Overlay::init(overlay, font);
+  Overlay::toggle(overlay);
+  Render::T target = Render::init(texture);
+
+  Alloc::Counters allocations;
+  Alloc::Counters last;
+  int allocatingFrames = 0;
+  sf::Clock clock;
+
+  for (int i = 0; i < warmup + frames; ++i) {
+    if (i == warmup) {
+      Alloc::clearSites();
+      Alloc::trackSites(true);
+      clock.restart();
+    }
+    Alloc::Counters before = Alloc::local();
+
+    // The input of sim_steps
+    auto key = i % 180 == 0 ? sf::Keyboard::Up
+               : i % 20 < 10 ? sf::Keyboard::Left
+                             : sf::Keyboard::Right;
+    if (i % 10 == 0) {
+      Keys::push(keys, {key, true, state.time, sf::Time::Zero});
+    } else if (i % 10 == 5) {
+      Keys::push(keys, {key, false, state.time, sf::Time::Zero});
+    }
+    Alloc::Counters beforeStep = Alloc::local();
+    state = State::step(state, keys);
+    Particles::trigger(particles, state.events);
+    state.events = State::Events{};
+    Particles::update(particles, fixedStep.asSeconds());
+    if (state.name == State::Name::LOST) {
+      state = playAgain(state);
+    }
+    Alloc::Counters step = Alloc::local() - beforeStep;
+
+    texture.clear(COLOR_BACKGROUND);
+    Grid::draw(grid, target);
+    State::draw(state, target);
+    Particles::draw(particles, target);
+    Hud::update(hud, state);
+    Hud::draw(hud, target);
+    Overlay::draw(overlay, target, sf::Time::Zero, 1, last, step);
+    texture.display();
+    Render::endFrame(target);
+
+    last = Alloc::local() - before;
+    if (i >= warmup) {
+      allocations = allocations + last;
+      allocatingFrames += last.allocations > 0 ? 1 : 0;
+    }
+  }
+  Alloc::trackSites(false);
+
+  Result result;
+  result.name = "alloc_frame";
+  result.iterations = frames;
+  result.milliseconds = clock.getElapsedTime().asSeconds() * 1000.0 / frames;
+  result.render = target.last;
+  result.metrics.push_back(
+      {"allocations_per_frame", double(allocations.allocations) / frames});
+  result.metrics.push_back(
+      {"bytes_per_frame", double(allocations.bytes) / frames});
+  result.metrics.push_back({"allocating_frames", double(allocatingFrames)});
+  result.metrics.push_back(
+      {"arena_high_water", double(target.arena.highWater)});
+  result.metrics.push_back({"passed", allocatingFrames == 0 ? 1. : 0.});
+
+  if (allocatingFrames > 0) {
+    isFailed = true;
+    std::cerr << "alloc_frame: " << allocatingFrames
+              << " frames allocated, top sites: ";
+    Alloc::writeSites(std::cerr, 10);
+    std::cerr << std::endl;
+  }
+  return result;
+}
+
+// Moves through every item and option of the page shown, drawing each move
+void trainPage(Menu::T &menu, Render::T &target, sf::RenderTexture &texture) {
+  const std::function<void(Menu::T &)> moves[] = {
+      Menu::selectRight, Menu::selectLeft, Menu::selectRight, Menu::selectDown};
+  std::size_t items = menu.pages[menu.depth - 1]->items.size();
+
+  for (std::size_t i = 0; i < items; ++i) {
+    for (const auto &move : moves) {
+      move(menu);
+      texture.clear(COLOR_BACKGROUND);
+      Menu::draw(menu, target);
+      texture.display();
+      Render::endFrame(target);
+    }
+  }
+}
+
+// Every page of the menus, the nested ones opened from their parent
+void trainMenus(Render::T &target, sf::RenderTexture &texture,
+                const sf::Font &font) {
+  Menu::T menu = Menu::init([](Menu::Action, float) {});
+  menu.font = &font;
+
+  for (const Menu::Page *page : {&Menu::MAIN, &Menu::PAUSE, &Menu::GAME_OVER}) {
+    Menu::open(menu, *page);
+    trainPage(menu, target, texture);
+  }
+
+  // Restart then Settings
+  for (int item = 1; item <= 2; ++item) {
+    Menu::open(menu, Menu::PAUSE);
+    for (int i = 0; i < item; ++i) {
+      Menu::selectDown(menu);
+    }
+    Menu::choose(menu);
+    trainPage(menu, target, texture);
+    Menu::cancel(menu);
+  }
+}
+
+// The training run of the profile-guided build, see cmake/pgo.cmake: the
+// menus, then the bot places `pieces` pieces with a frame drawn after each.
+// Deterministic, the same run gives the same profile.
+Result train(sf::RenderTexture &texture, const Grid::T &grid,
+             const sf::Font &font, int pieces) {
+  Render::T target = Render::init(texture);
+  sf::Clock clock;
+
+  trainMenus(target, texture, font);
+
+  State::T state = State::init(0);
+  state.name = State::Name::PLAYING;
+  Keys::T keys;
+  Particles::T particles = Particles::init();
+  Hud::T hud;
+  Hud::init(hud, font, HUD_ORIGIN);
+  int placed = 0;
+  int lines = 0;
+  int games = 1;
+
+  while (placed + state.pieces < pieces) {
+    state = Bot::play(state, Bot::best(state));
+    if (state.name != State::Name::LOST) {
+      state = State::step(state, keys);
+    }
+    Particles::trigger(particles, state.events);
+    state.events = State::Events{};
+    Particles::update(particles, fixedStep.asSeconds());
+
+    texture.clear(COLOR_BACKGROUND);
+    Grid::draw(grid, target);
+    State::draw(state, target);
+    Particles::draw(particles, target);
+    Hud::update(hud, state);
+    Hud::draw(hud, target);
+    texture.display();
+    Render::endFrame(target);
+
+    if (state.name == State::Name::LOST) {
+      placed += state.pieces;
+      lines += state.lines;
+      games += 1;
+      state = playAgain(state);
+    }
+  }
+  placed += state.pieces;
+  lines += state.lines;
+
+  double seconds = clock.getElapsedTime().asSeconds();
+  Result result;
+  result.name = "train";
+  result.iterations = placed;
+  result.milliseconds = seconds * 1000.0 / placed;
+  result.render = target.last;
+  result.metrics.push_back({"lines", double(lines)});
+  result.metrics.push_back({"games", double(games)});
+  result.metrics.push_back({"pieces_per_second", placed / seconds});
+  return result;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::vector<std::string> filters;
+  std::string position;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.rfind("--position=", 0) == 0) {
+      position = arg.substr(11);
+    } else {
+      filters.push_back(arg);
+    }
+  }
+  constexpr int frames = 600;
+
+  sf::RenderTexture texture;
+  texture.create(WINDOW_WIDTH, WINDOW_HEIGHT);
+
+  Grid::T grid = Grid::init(GRID_ORIGIN);
+  State::T state = State::init();
+  Loader::T loader;
+  Loader::start(loader);
+  Loader::wait(loader);
+  Menu::T menu = Menu::init([](Menu::Action, float) {});
+  menu.font = &loader.font;
+
+  std::vector<Result> results;
+
+  if (isSelected(filters, "render_game")) {
+    results.push_back(renderFrames("render_game", texture, frames,
+                                   [&grid, &state](Render::T &target) {
+                                     Grid::draw(grid, target);
+                                     State::draw(state, target);
+                                   }));
+  }
+
+  if (isSelected(filters, "render_menu")) {
+    results.push_back(renderFrames("render_menu", texture, frames,
+                                   [&grid, &state, &menu](Render::T &target) {
+                                     Grid::draw(grid, target);
+                                     State::draw(state, target);
+                                     Menu::draw(menu, target);
+                                   }));
+  }
+
+  if (isSelected(filters, "render_hud")) {
+    Hud::T hud;
+    Hud::init(hud, loader.font, HUD_ORIGIN);
+    State::T playing = state;
+    int frame = 0;
+
+    results.push_back(renderFrames(
+        "render_hud", texture, frames, [&](Render::T &target) {
+          // Values change a few times per second, like in a real game
+          if (++frame % 20 == 0) {
+            playing.score += 100;
+            playing.piece = Piece::reset(playing.piece, NUMCOLS);
+          }
+          playing.time += fixedStep;
+          Hud::update(hud, playing);
+          Hud::draw(hud, target);
+        }));
+  }
+
+  if (isSelected(filters, "particles_10k")) {
+    Particles::T particles = Particles::init();
+    std::minstd_rand gen;
+    std::uniform_real_distribution<float> spread(-SQUARESIZE, SQUARESIZE);
+    for (int i = 0; i < 10000; ++i) {
+      sf::Vector2f position(WINDOW_WIDTH / 2.f, WINDOW_HEIGHT / 2.f);
+      sf::Vector2f velocity(spread(gen), spread(gen));
+      // Long lived so that they all stay alive during the benchmark
+      Particles::emit(particles, position, velocity, 1e6f, sf::Color::White);
+    }
+
+    sf::Clock updateClock;
+    sf::Time updateTime;
+    Result result = renderFrames(
+        "particles_10k", texture, frames, [&](Render::T &target) {
+          updateClock.restart();
+          Particles::update(particles, fixedStep.asSeconds());
+          updateTime += updateClock.getElapsedTime();
+          Particles::draw(particles, target);
+        });
+    result.metrics.push_back(
+        {"update_ms", updateTime.asSeconds() * 1000.0 / frames});
+    result.metrics.push_back({"live_particles", double(particles.count)});
+    results.push_back(result);
+  }
+
+  if (isSelected(filters, "render_wall")) {
+    Wall::T wall = Wall::init(Wall::MAX_BOARDS, 0, 0,
+                              sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
+    results.push_back(renderFrames("render_wall", texture, frames,
+                                   [&wall](Render::T &target) {
+                                     Wall::step(wall);
+                                     Wall::draw(wall, target);
+                                   }));
+  }
+
+  bool isFailed = false;
+  if (isSelected(filters, "alloc_frame")) {
+    results.push_back(checkAllocations(texture, grid, loader.font, isFailed));
+  }
+
+  if (isSelected(filters, "sim_steps")) {
+    results.push_back(simulateSteps<State::T>("sim_steps", 6000, position));
+  }
+  if (isSelected(filters, "sim_drill")) {
+    results.push_back(simulateSteps<State::Drill>("sim_drill", 6000, position));
+  }
+  if (isSelected(filters, "sim_marathon")) {
+    results.push_back(simulateSteps<State::Marathon>("sim_marathon", 6000,
+                                                         position));
+  }
+  if (isSelected(filters, "sim_party")) {
+    results.push_back(simulateSteps<State::Party>("sim_party", 6000, position));
+  }
+
+  if (isSelected(filters, "pool_steps")) {
+    results.push_back(simulatePool(1000, 600));
+  }
+
+  if (isSelected(filters, "wall_steps")) {
+    results.push_back(simulateWall(600));
+  }
+
+  if (isSelected(filters, "spectator_stream")) {
+    results.push_back(streamSpectator(36000, isFailed));
+  }
+
+  if (isSelected(filters, "virtual_10min")) {
+    results.push_back(playTenMinutes(isFailed));
+  }
+
+  if (isSelected(filters, "snapshot_load")) {
+    results.push_back(loadSnapshot(1000, isFailed));
+  }
+
+  if (isSelected(filters, "rotation_kicks")) {
+    results.push_back(resolveKicks(20, isFailed));
+  }
+
+  if (isExplicitlySelected(filters, "train")) {
+    results.push_back(train(texture, grid, loader.font, 10000));
+  }
+
+  if (isExplicitlySelected(filters, "startup")) {
+    results.push_back(measureStartup());
+  }
+
+  for (auto policy :
+       {Scheduler::VSYNC, Scheduler::FIXED_CAP, Scheduler::PRECISE_SLEEP}) {
+    std::string name = std::string("latency_") + Scheduler::name(policy);
+    if (isExplicitlySelected(filters, name)) {
+      results.push_back(measureLatency(policy));
+    }
+  }
+
+  std::cout << "{\n  \"benchmarks\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    writeJson(results[i], std::cout);
+    std::cout << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  std::cout << "  ]\n}" << std::endl;
+
+  // A guard failed, see alloc_frame, spectator_stream, virtual_10min,
+  // snapshot_load and rotation_kicks
+  return isFailed ? 1 : 0;
+}
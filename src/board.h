@@ -0,0 +1,196 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include "piece.h"
+#include "profile.h"
+#include "render.h"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// The grid of locked blocks, sized at compile time for the variants of the
+// game. A row is a bit mask of the narrowest integer holding it, so the
+// collision and line checks stay a few instructions whatever the width.
+namespace Board {
+
+template <int Width>
+using Row = std::conditional_t<
+    Width <= 16, std::uint16_t,
+    std::conditional_t<Width <= 32, std::uint32_t, std::uint64_t>>;
+
+// One bit per row, 0 is the top of the grid
+using Rows = std::uint64_t;
+
+template <int Width, int Height> struct T {
+  static_assert(Width > 0 && Width <= 64, "a row must fit in 64 bits");
+  static_assert(Height > 0 && Height <= 64, "rows must fit in Rows");
+
+  static constexpr int WIDTH = Width;
+  static constexpr int HEIGHT = Height;
+  using Row = Board::Row<Width>;
+  // Shifted once narrowed, ~ promotes the narrower types to int
+  static constexpr Row FULL_ROW =
+      Row(Row(~Row(0)) >> (8 * sizeof(Row) - Width));
+
+  // Type of the piece each cell was locked from, 0 when empty
+  std::array<std::array<std::uint8_t, Width>, Height> cells = {};
+  // Occupancy, one bit per column, kept in sync with cells
+  std::array<Row, Height> rows = {};
+};
+
+// Cells above the grid are free
+template <int Width, int Height>
+bool isOccupied(const T<Width, Height> &t, int col, int row) {
+  if (row < 0) {
+    return false;
+  }
+  return t.rows[row] & (typename T<Width, Height>::Row(1) << col);
+}
+
+// Against the sides, the bottom or the stack
+template <int Width, int Height>
+bool collides(const T<Width, Height> &t, const Piece::Cells &cells) {
+  for (const auto &cell : cells) {
+    if (cell.x < 0 || cell.x >= Width || cell.y >= Height) {
+      return true;
+    }
+    if (isOccupied(t, cell.x, cell.y)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Index of the first of the kicks where the footprint fits from `position`,
+// -1 when none does. A test is a load and a mask per row of the piece.
+template <int Width, int Height>
+int firstFit(const T<Width, Height> &t, const Piece::Footprint &footprint,
+             sf::Vector2i position, const Piece::Kicks &kicks) {
+  using Row = typename T<Width, Height>::Row;
+  for (int i = 0; i < Piece::KICK_TESTS; ++i) {
+    int x = position.x + kicks[i].x + footprint.left;
+    int y = position.y + kicks[i].y + footprint.top;
+    if (x < 0 || x + footprint.width > Width ||
+        y + footprint.height > Height) {
+      continue;
+    }
+    // Unrolled over the rows a piece can take, past its height the masks
+    // are empty. Rows above the grid are free.
+    Row hit = 0;
+    for (int row = 0; row < 4; ++row) {
+      int at = y + row;
+      Row cells = at < 0 || at >= Height ? Row(0) : t.rows[at];
+      hit |= cells & Row(Row(footprint.rows[row]) << x);
+    }
+    if (hit == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Cells outside of the grid are dropped
+template <int Width, int Height>
+T<Width, Height> add(T<Width, Height> t, const Piece::Cells &cells,
+                     int type) {
+  using Row = typename T<Width, Height>::Row;
+  for (const auto &cell : cells) {
+    if (cell.x >= 0 && cell.x < Width && cell.y >= 0 && cell.y < Height) {
+      t.cells[cell.y][cell.x] = std::uint8_t(type);
+      t.rows[cell.y] |= Row(1) << cell.x;
+    }
+  }
+  return t;
+}
+
+template <int Width, int Height> Rows fullRows(const T<Width, Height> &t) {
+  Rows full = 0;
+  for (int row = 0; row < Height; ++row) {
+    if (t.rows[row] == T<Width, Height>::FULL_ROW) {
+      full |= Rows(1) << row;
+    }
+  }
+  return full;
+}
+
+// The rows above each removed row fall into its place
+template <int Width, int Height>
+T<Width, Height> removeRows(T<Width, Height> t, Rows rows) {
+  // Compacts from the bottom, `to` is where the next kept row goes
+  int to = Height - 1;
+  for (int from = Height - 1; from >= 0; --from) {
+    if (rows & (Rows(1) << from)) {
+      continue;
+    }
+    if (to != from) {
+      t.cells[to] = t.cells[from];
+      t.rows[to] = t.rows[from];
+    }
+    to -= 1;
+  }
+  for (; to >= 0; --to) {
+    t.cells[to] = {};
+    t.rows[to] = 0;
+  }
+  return t;
+}
+
+// Pushes the stack up by `count` rows full but for the column `hole`, the
+// rows pushed out of the top are lost
+template <int Width, int Height>
+T<Width, Height> addGarbage(T<Width, Height> t, int count, int hole) {
+  using Row = typename T<Width, Height>::Row;
+  count = count < Height ? count : Height;
+  for (int row = 0; row + count < Height; ++row) {
+    t.cells[row] = t.cells[row + count];
+    t.rows[row] = t.rows[row + count];
+  }
+  for (int row = Height - count; row < Height; ++row) {
+    t.cells[row].fill(std::uint8_t(Piece::GARBAGE));
+    t.cells[row][hole] = 0;
+    t.rows[row] = T<Width, Height>::FULL_ROW & Row(~(Row(1) << hole));
+  }
+  return t;
+}
+
+// One draw call for all the locked blocks, `origin` is the top left corner
+// of the grid and `size` the side of a cell, in pixels
+template <int Width, int Height>
+void draw(const T<Width, Height> &t, Render::T &target, sf::Vector2f origin,
+          float size) {
+  PROFILE_ZONE("Board::draw");
+  std::size_t blocks = 0;
+  for (auto row : t.rows) {
+    blocks += std::popcount(row);
+  }
+  if (blocks == 0) {
+    return;
+  }
+
+  sf::Vertex *vertices = Render::vertices(target, blocks * 4);
+  std::size_t count = 0;
+  for (int row = 0; row < Height; ++row) {
+    if (t.rows[row] == 0) {
+      continue;
+    }
+    for (int col = 0; col < Width; ++col) {
+      int type = t.cells[row][col];
+      if (type == 0) {
+        continue;
+      }
+      sf::Vector2f corner(origin.x + col * size - Piece::OUTLINE,
+                          origin.y + row * size - Piece::OUTLINE);
+      Render::square(&vertices[count], corner, size + 2 * Piece::OUTLINE,
+                     Piece::color(type));
+      count += 4;
+    }
+  }
+  Render::draw(target, vertices, count, sf::Quads);
+}
+
+} // namespace Board
+
+#endif // !BOARD_H
@@ -0,0 +1,171 @@
+#include "bot.h"
+#include "board.h"
+#include "constants.h"
+#include "pool.h"
+#include "profile.h"
+#include "state.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+namespace Bot {
+
+// Every orientation is a turn away but the opposite one, reached by two
+// clockwise. Turns may be kicked, shifts stop at the walls.
+constexpr int MIN_ROTATIONS = -1;
+constexpr int MAX_ROTATIONS = 2;
+constexpr int MAX_SHIFT = NUMCOLS / 2;
+
+// Weights of a well known hand tuned evaluation
+constexpr float HEIGHT_WEIGHT = -0.51f;
+constexpr float LINES_WEIGHT = 0.76f;
+constexpr float HOLES_WEIGHT = -0.36f;
+constexpr float BUMPINESS_WEIGHT = -0.18f;
+
+// `occupied(col, row)` tells whether a cell of the grid is taken after the
+// move, which cleared `lines`
+template <typename Occupied> float evaluate(Occupied occupied, int lines) {
+  int heights[NUMCOLS] = {};
+  int holes = 0;
+  for (int col = 0; col < NUMCOLS; ++col) {
+    for (int row = 0; row < NUMROWS; ++row) {
+      if (occupied(col, row)) {
+        if (heights[col] == 0) {
+          heights[col] = NUMROWS - row;
+        }
+      } else if (heights[col] > 0) {
+        holes += 1;
+      }
+    }
+  }
+
+  int height = 0;
+  int bumpiness = 0;
+  for (int col = 0; col < NUMCOLS; ++col) {
+    height += heights[col];
+    if (col > 0) {
+      bumpiness += std::abs(heights[col] - heights[col - 1]);
+    }
+  }
+
+  return HEIGHT_WEIGHT * height + LINES_WEIGHT * lines +
+         HOLES_WEIGHT * holes + BUMPINESS_WEIGHT * bumpiness;
+}
+
+float evaluate(const State::T &before, const State::T &after) {
+  if (after.name == State::Name::LOST) {
+    return -std::numeric_limits<float>::infinity();
+  }
+  auto occupied = [&after](int col, int row) {
+    return Board::isOccupied(after.board, col, row);
+  };
+  return evaluate(occupied, after.lines - before.lines);
+}
+
+State::T play(State::T state, Move move) {
+  auto turn = move.rotations < 0 ? sf::Keyboard::Z : sf::Keyboard::Space;
+  for (int i = 0; i < std::abs(move.rotations); ++i) {
+    state = State::manageKeyPressed(state, turn, true, state.time);
+  }
+  auto key = move.shift < 0 ? sf::Keyboard::Left : sf::Keyboard::Right;
+  for (int i = 0; i < std::abs(move.shift); ++i) {
+    state = State::manageKeyPressed(state, key, true, state.time);
+  }
+  return State::manageKeyPressed(state, sf::Keyboard::Up, true, state.time);
+}
+
+Move best(const State::T &state) {
+  PROFILE_ZONE("Bot::best");
+  Move best;
+  float bestScore = -std::numeric_limits<float>::infinity();
+
+  for (int rotations = MIN_ROTATIONS; rotations <= MAX_ROTATIONS;
+       ++rotations) {
+    for (int shift = -MAX_SHIFT; shift <= MAX_SHIFT; ++shift) {
+      Move move = {rotations, shift};
+      float score = evaluate(state, play(state, move));
+      if (score > bestScore) {
+        best = move;
+        bestScore = score;
+      }
+    }
+  }
+  return best;
+}
+
+// Where the piece lands on a copy of the rows, once its full rows removed
+float evaluate(const Pool::Row *board, const Pool::Shape &shape, int x) {
+  Pool::Row rows[Pool::STRIDE];
+  std::copy(board, board + Pool::STRIDE, rows);
+  int y = 0;
+  while (!Pool::collides(rows, shape, x, y + 1)) {
+    y += 1;
+  }
+  for (int i = 0; i < Pool::SHAPE_ROWS; ++i) {
+    rows[y + Pool::SHAPE_TOP + Pool::GUTTER + i] |= Pool::at(shape[i], x);
+  }
+  if (rows[Pool::GUTTER] != Pool::EMPTY_ROW) {
+    // Out of the top, or so close that the next piece would be
+    return -std::numeric_limits<float>::infinity();
+  }
+
+  Pool::Row *grid = rows + Pool::GUTTER;
+  int to = NUMROWS - 1;
+  for (int from = NUMROWS - 1; from >= 0; --from) {
+    if (grid[from] != Pool::FULL_ROW) {
+      grid[to--] = grid[from];
+    }
+  }
+  int lines = to + 1;
+  for (; to >= 0; --to) {
+    grid[to] = Pool::EMPTY_ROW;
+  }
+
+  auto occupied = [grid](int col, int row) {
+    return (grid[row] >> (col + Pool::GUTTER)) & 1;
+  };
+  return evaluate(occupied, lines);
+}
+
+Move best(const Pool::T &pool, int board) {
+  PROFILE_ZONE("Bot::best");
+  const Pool::Row *rows = Pool::rows(pool, board);
+  Move best;
+  float bestScore = -std::numeric_limits<float>::infinity();
+
+  for (int rotations = MIN_ROTATIONS; rotations <= MAX_ROTATIONS;
+       ++rotations) {
+    // Where the turns leave the piece, kicks included
+    int orientation = pool.orientation[board];
+    int x = pool.x[board];
+    int y = pool.y[board];
+    bool turned = true;
+    for (int i = 0; i < std::abs(rotations) && turned; ++i) {
+      turned = Pool::turn(pool, board, rotations < 0 ? -1 : 1, orientation,
+                          x, y);
+    }
+    if (!turned) {
+      continue;
+    }
+    const Pool::Shape &shape =
+        Pool::shape(pool, pool.type[board], orientation);
+    // Columns the piece can reach from there, at its height
+    for (int direction : {-1, 1}) {
+      for (int shift = direction == -1 ? 0 : 1; shift <= MAX_SHIFT;
+           ++shift) {
+        int column = x + direction * shift;
+        if (Pool::collides(rows, shape, column, y)) {
+          break;
+        }
+        float score = evaluate(rows, shape, column);
+        if (score > bestScore) {
+          best = {rotations, direction * shift};
+          bestScore = score;
+        }
+      }
+    }
+  }
+  return best;
+}
+
+} // namespace Bot
@@ -0,0 +1,31 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include "pool.h"
+#include "state.h"
+
+// Plays by itself: tries every rotation and column of the current piece and
+// hard drops where the board looks best. Deterministic, it drives the
+// training workload of the profile-guided build, see cmake/pgo.cmake.
+namespace Bot {
+
+// Key presses placing the current piece, then a hard drop
+struct Move {
+  // Clockwise turns, negative counter-clockwise
+  int rotations = 0;
+  // Columns to the right, negative to the left
+  int shift = 0;
+};
+
+Move best(const State::T &state);
+
+// Presses the keys of the move all at once, at the time of the state
+State::T play(State::T state, Move move);
+
+// The same search on a board of a pool, without simulating the rules: the
+// piece is dropped where it is on the bit masks of the rows
+Move best(const Pool::T &pool, int board);
+
+} // namespace Bot
+
+#endif // !BOT_H
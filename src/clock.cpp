@@ -0,0 +1,31 @@
+#include "clock.h"
+#include <SFML/System.hpp>
+
+namespace Clock {
+
+T init(Kind kind) {
+  T t;
+  t.kind = kind;
+  return t;
+}
+
+sf::Time now(const T &t) {
+  return t.kind == REAL ? t.real.getElapsedTime() : t.now;
+}
+
+sf::Time elapsed(const T &t) { return now(t) - t.restartedAt; }
+
+sf::Time restart(T &t) {
+  sf::Time current = now(t);
+  sf::Time elapsed = current - t.restartedAt;
+  t.restartedAt = current;
+  return elapsed;
+}
+
+void advance(T &t, sf::Time time) {
+  if (t.kind == VIRTUAL) {
+    t.now += time;
+  }
+}
+
+} // namespace Clock
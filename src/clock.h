@@ -0,0 +1,39 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <SFML/System.hpp>
+
+namespace Clock {
+
+enum Kind {
+  // Wall time, from sf::Clock
+  REAL,
+  // Only moves with advance(), to run the game faster than real time with
+  // exactly the same timings
+  VIRTUAL,
+};
+
+struct T {
+  Kind kind = REAL;
+  sf::Clock real;
+  sf::Time now = sf::Time::Zero;
+  sf::Time restartedAt = sf::Time::Zero;
+};
+
+T init(Kind kind);
+
+// Since init
+sf::Time now(const T &t);
+
+// Since the last restart
+sf::Time elapsed(const T &t);
+
+// Returns the time elapsed since the last restart
+sf::Time restart(T &t);
+
+// Moves a virtual clock forward, ignored by a real one
+void advance(T &t, sf::Time time);
+
+} // namespace Clock
+
+#endif // !CLOCK_H
@@ -8,10 +8,19 @@ constexpr float SQUARESIZE = 80.0f;
 constexpr int NUMROWS = 20;
 constexpr int NUMCOLS = 10;
 constexpr int OFFSET_GRID = 1;
+// Score, level and next pieces, on the right of the grid
+constexpr int HUD_COLS = 6;
 
-constexpr float WINDOW_WIDTH = (NUMCOLS + 2 * OFFSET_GRID) * SQUARESIZE;
+constexpr float WINDOW_WIDTH =
+    (NUMCOLS + 2 * OFFSET_GRID + HUD_COLS) * SQUARESIZE;
 constexpr float WINDOW_HEIGHT = (NUMROWS + 2 * OFFSET_GRID) * SQUARESIZE;
 
+// Top left corner of the grid in pixels
+const sf::Vector2f GRID_ORIGIN =
+    sf::Vector2f(OFFSET_GRID * SQUARESIZE, OFFSET_GRID * SQUARESIZE);
+const sf::Vector2f HUD_ORIGIN = sf::Vector2f(
+    (NUMCOLS + 2 * OFFSET_GRID) * SQUARESIZE, OFFSET_GRID * SQUARESIZE);
+
 // Colors
 const sf::Color COLOR_BACKGROUND = sf::Color::Black;
 const sf::Color COLOR_OUTLINE = sf::Color::Magenta;
@@ -19,5 +28,16 @@ const sf::Color COLOR_OUTLINE = sf::Color::Magenta;
 // Movement
 constexpr float fixedNumberOfFrames = 60.0f;
 constexpr float fixedTimeStep = 1.0f / fixedNumberOfFrames;
+// Exact duration of a step in simulation time, rounded up to the microsecond
+// so that n steps never last less than n / 60 s
+const sf::Time fixedStep = sf::microseconds(1000000 / 60 + 1);
+// Steps simulated at most per frame, the rest of the late time is dropped
+constexpr int maxStepsPerFrame = 8;
+// Frames taking longer than this pause the game instead of catching up
+constexpr float maxFrameGap = 0.25f;
+// Fast forward factors cycled with F4, zero runs as many steps as fit in the
+// frame budget and only the latest state is drawn
+constexpr int turboFactors[] = {1, 2, 10, 0};
+constexpr float turboFrameBudget = 0.75f * fixedTimeStep;
 
 #endif // !CONSTANTS_H
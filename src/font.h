@@ -1,1450 +0,0 @@
-#ifndef FONT_H
-#define FONT_H
-
-constexpr unsigned char ARCADECLASSIC_TTF[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x30, 0x00, 0x03, 0x00, 0xc0,
-    0x4f, 0x53, 0x2f, 0x32, 0x51, 0x57, 0x5e, 0x39, 0x00, 0x00, 0x42, 0x84,
-    0x00, 0x00, 0x00, 0x56, 0x50, 0x43, 0x4c, 0x54, 0x53, 0xa1, 0xe3, 0x46,
-    0x00, 0x00, 0x42, 0xdc, 0x00, 0x00, 0x00, 0x36, 0x63, 0x6d, 0x61, 0x70,
-    0x11, 0x60, 0x17, 0x81, 0x00, 0x00, 0x3a, 0x88, 0x00, 0x00, 0x02, 0xf4,
-    0x63, 0x76, 0x74, 0x20, 0x62, 0xc0, 0x63, 0x98, 0x00, 0x00, 0x03, 0xec,
-    0x00, 0x00, 0x00, 0x26, 0x66, 0x70, 0x67, 0x6d, 0x83, 0x33, 0xc2, 0x4f,
-    0x00, 0x00, 0x03, 0xd8, 0x00, 0x00, 0x00, 0x14, 0x67, 0x6c, 0x79, 0x66,
-    0x3c, 0xdb, 0x74, 0xcf, 0x00, 0x00, 0x04, 0x6c, 0x00, 0x00, 0x32, 0xc8,
-    0x68, 0x64, 0x6d, 0x78, 0xff, 0x74, 0x83, 0x2a, 0x00, 0x00, 0x3d, 0x7c,
-    0x00, 0x00, 0x05, 0x08, 0x68, 0x65, 0x61, 0x64, 0xd5, 0xc2, 0x7d, 0x5d,
-    0x00, 0x00, 0x43, 0x14, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-    0x05, 0x07, 0x03, 0x97, 0x00, 0x00, 0x43, 0x4c, 0x00, 0x00, 0x00, 0x24,
-    0x68, 0x6d, 0x74, 0x78, 0x98, 0xa0, 0x00, 0xf4, 0x00, 0x00, 0x38, 0x68,
-    0x00, 0x00, 0x01, 0x30, 0x6c, 0x6f, 0x63, 0x61, 0x00, 0x08, 0x44, 0xce,
-    0x00, 0x00, 0x37, 0x34, 0x00, 0x00, 0x01, 0x34, 0x6d, 0x61, 0x78, 0x70,
-    0x00, 0xdc, 0x01, 0x4c, 0x00, 0x00, 0x43, 0x70, 0x00, 0x00, 0x00, 0x20,
-    0x6e, 0x61, 0x6d, 0x65, 0xa0, 0xba, 0x63, 0x69, 0x00, 0x00, 0x00, 0xfc,
-    0x00, 0x00, 0x02, 0xdc, 0x70, 0x6f, 0x73, 0x74, 0xe6, 0x41, 0xa9, 0x13,
-    0x00, 0x00, 0x39, 0x98, 0x00, 0x00, 0x00, 0xee, 0x70, 0x72, 0x65, 0x70,
-    0xd8, 0xb5, 0xc4, 0x95, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x57,
-    0x00, 0x00, 0x00, 0x18, 0x01, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xac, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x1a, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x0e, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x1a, 0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x1a, 0x01, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x02, 0x01, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x1a, 0x01, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x01, 0xb6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x0d, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x07, 0x01, 0x29, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x0d, 0x01, 0x65, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x0d, 0x01, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x01, 0x01, 0x8c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x0d, 0x01, 0x8f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x01, 0xb6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x00, 0x00, 0xac, 0x00, 0x56, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x01, 0x00, 0x1a, 0x01, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x02, 0x00, 0x0e, 0x01, 0x30, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x03, 0x00, 0x1a, 0x01, 0x72, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x04, 0x00, 0x1a, 0x01, 0x4b, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x05, 0x00, 0x02, 0x01, 0x8d, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x06, 0x00, 0x1a, 0x01, 0x9c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x07, 0x00, 0x00, 0x01, 0xb6, 0x28, 0x63, 0x29, 0x20, 0x4a, 0x61,
-    0x6b, 0x6f, 0x62, 0x20, 0x46, 0x69, 0x73, 0x63, 0x68, 0x65, 0x72, 0x20,
-    0x61, 0x74, 0x20, 0x77, 0x77, 0x77, 0x2e, 0x70, 0x69, 0x7a, 0x7a, 0x61,
-    0x64, 0x75, 0x64, 0x65, 0x2e, 0x64, 0x6b, 0x20, 0x2d, 0x20, 0x44, 0x4f,
-    0x20, 0x4e, 0x4f, 0x54, 0x20, 0x44, 0x49, 0x53, 0x54, 0x52, 0x49, 0x42,
-    0x55, 0x54, 0x45, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20,
-    0x41, 0x55, 0x54, 0x48, 0x4f, 0x52, 0x27, 0x53, 0x20, 0x50, 0x45, 0x52,
-    0x4d, 0x49, 0x53, 0x53, 0x49, 0x4f, 0x4e, 0x21, 0x00, 0x28, 0x00, 0x63,
-    0x00, 0x29, 0x00, 0x20, 0x00, 0x4a, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x6f,
-    0x00, 0x62, 0x00, 0x20, 0x00, 0x46, 0x00, 0x69, 0x00, 0x73, 0x00, 0x63,
-    0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x61, 0x00, 0x74,
-    0x00, 0x20, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x70,
-    0x00, 0x69, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x61, 0x00, 0x64, 0x00, 0x75,
-    0x00, 0x64, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x20,
-    0x00, 0x2d, 0x00, 0x20, 0x00, 0x44, 0x00, 0x4f, 0x00, 0x20, 0x00, 0x4e,
-    0x00, 0x4f, 0x00, 0x54, 0x00, 0x20, 0x00, 0x44, 0x00, 0x49, 0x00, 0x53,
-    0x00, 0x54, 0x00, 0x52, 0x00, 0x49, 0x00, 0x42, 0x00, 0x55, 0x00, 0x54,
-    0x00, 0x45, 0x00, 0x20, 0x00, 0x57, 0x00, 0x49, 0x00, 0x54, 0x00, 0x48,
-    0x00, 0x4f, 0x00, 0x55, 0x00, 0x54, 0x00, 0x20, 0x00, 0x41, 0x00, 0x55,
-    0x00, 0x54, 0x00, 0x48, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x27, 0x00, 0x53,
-    0x00, 0x20, 0x00, 0x50, 0x00, 0x45, 0x00, 0x52, 0x00, 0x4d, 0x00, 0x49,
-    0x00, 0x53, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x21,
-    0x41, 0x72, 0x63, 0x61, 0x64, 0x65, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69,
-    0x63, 0x00, 0x41, 0x00, 0x72, 0x00, 0x63, 0x00, 0x61, 0x00, 0x64, 0x00,
-    0x65, 0x00, 0x43, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00,
-    0x69, 0x00, 0x63, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x00, 0x52,
-    0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72,
-    0x41, 0x72, 0x63, 0x61, 0x64, 0x65, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69,
-    0x63, 0x00, 0x41, 0x00, 0x72, 0x00, 0x63, 0x00, 0x61, 0x00, 0x64, 0x00,
-    0x65, 0x00, 0x43, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00,
-    0x69, 0x00, 0x63, 0x41, 0x72, 0x63, 0x61, 0x64, 0x65, 0x43, 0x6c, 0x61,
-    0x73, 0x73, 0x69, 0x63, 0x00, 0x41, 0x00, 0x72, 0x00, 0x63, 0x00, 0x61,
-    0x00, 0x64, 0x00, 0x65, 0x00, 0x43, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x73,
-    0x00, 0x73, 0x00, 0x69, 0x00, 0x63, 0x32, 0x00, 0x32, 0x41, 0x72, 0x63,
-    0x61, 0x64, 0x65, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x63, 0x00, 0x41,
-    0x00, 0x72, 0x00, 0x63, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x43,
-    0x00, 0x6c, 0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x63,
-    0x40, 0x01, 0x00, 0x2c, 0x76, 0x45, 0x20, 0xb0, 0x03, 0x25, 0x45, 0x23,
-    0x61, 0x68, 0x18, 0x23, 0x68, 0x60, 0x44, 0x2d, 0x00, 0x43, 0x02, 0x38,
-    0x00, 0x8f, 0x00, 0xd6, 0x00, 0x48, 0x00, 0x8f, 0x01, 0xf2, 0x01, 0xab,
-    0x00, 0xd8, 0x01, 0x66, 0x01, 0xf2, 0x01, 0x66, 0x01, 0xac, 0x01, 0x20,
-    0x00, 0xd8, 0x5a, 0x62, 0x5a, 0x62, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00,
-    0x40, 0x17, 0x0e, 0x0e, 0x0d, 0x0d, 0x0c, 0x0c, 0x0b, 0x0b, 0x0a, 0x0a,
-    0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x01, 0x01, 0x00, 0x00,
-    0x01, 0x8d, 0xb8, 0x01, 0xff, 0x85, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44,
-    0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44,
-    0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44,
-    0x45, 0x68, 0x44, 0xb3, 0x03, 0x02, 0x46, 0x00, 0x2b, 0xb3, 0x05, 0x04,
-    0x46, 0x00, 0x2b, 0xb1, 0x02, 0x02, 0x45, 0x68, 0x44, 0xb1, 0x04, 0x04,
-    0x45, 0x68, 0x44, 0x00, 0x00, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x01, 0xb6,
-    0x03, 0x2c, 0x00, 0x03, 0x00, 0x07, 0x00, 0x55, 0x40, 0x1f, 0x01, 0x08,
-    0x08, 0x40, 0x09, 0x02, 0x07, 0x04, 0x02, 0x01, 0x00, 0x06, 0x05, 0x02,
-    0x03, 0x02, 0x05, 0x04, 0x04, 0x00, 0x07, 0x06, 0x04, 0x01, 0x02, 0x01,
-    0x03, 0x00, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c,
-    0x2f, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
-    0x00, 0x00, 0x00, 0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
-    0x11, 0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x33, 0x11, 0x21,
-    0x11, 0x25, 0x33, 0x11, 0x23, 0x3f, 0x01, 0x77, 0xfe, 0xc7, 0xfa, 0xfa,
-    0x03, 0x2c, 0xfc, 0xd4, 0x3f, 0x02, 0xaf, 0x00, 0x00, 0x02, 0x00, 0x17,
-    0x00, 0x41, 0x01, 0x7a, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x84,
-    0x40, 0x3c, 0x01, 0x10, 0x10, 0x40, 0x11, 0x00, 0x02, 0x01, 0x03, 0x07,
-    0x04, 0x03, 0x02, 0x07, 0x0a, 0x06, 0x05, 0x03, 0x09, 0x03, 0x0b, 0x00,
-    0x0f, 0x08, 0x07, 0x03, 0x0c, 0x02, 0x0e, 0x0d, 0x01, 0x00, 0x05, 0x0a,
-    0x03, 0x02, 0x05, 0x0a, 0x05, 0x04, 0x05, 0x0a, 0x09, 0x08, 0x05, 0x07,
-    0x06, 0x0f, 0x0e, 0x04, 0x0c, 0x0d, 0x0c, 0x00, 0x0b, 0x0a, 0x01, 0x01,
-    0x0d, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10,
-    0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c,
-    0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x0d, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59,
-    0x01, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x33, 0x35, 0x33,
-    0x01, 0x23, 0x35, 0x33, 0x01, 0x7a, 0x44, 0x48, 0x47, 0x49, 0x47, 0xd5,
-    0xfe, 0xe2, 0x45, 0x45, 0x01, 0xa7, 0x48, 0x47, 0x48, 0xd4, 0x8f, 0xfe,
-    0x0e, 0x46, 0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33,
-    0x00, 0x13, 0x00, 0x1b, 0x00, 0xb7, 0x40, 0x5b, 0x01, 0x1c, 0x1c, 0x40,
-    0x1d, 0x00, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x1a, 0x02, 0x08, 0x07, 0x0a,
-    0x09, 0x02, 0x05, 0x13, 0x00, 0x02, 0x0f, 0x17, 0x16, 0x02, 0x12, 0x11,
-    0x04, 0x03, 0x03, 0x05, 0x0e, 0x0d, 0x03, 0x0f, 0x19, 0x18, 0x06, 0x03,
-    0x05, 0x02, 0x0c, 0x0b, 0x15, 0x14, 0x10, 0x03, 0x0f, 0x02, 0x02, 0x01,
-    0x1b, 0x14, 0x03, 0x03, 0x02, 0x04, 0x04, 0x18, 0x17, 0x0d, 0x03, 0x0c,
-    0x04, 0x0e, 0x01, 0x00, 0x05, 0x16, 0x15, 0x13, 0x03, 0x12, 0x0b, 0x0a,
-    0x05, 0x1a, 0x19, 0x09, 0x03, 0x08, 0x0f, 0x0e, 0x01, 0x05, 0x04, 0x00,
-    0x01, 0x09, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
-    0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
-    0x00, 0x09, 0x00, 0x1c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
-    0x11, 0x37, 0xb9, 0x00, 0x1c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15,
-    0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x33, 0x03, 0x11, 0x23, 0x35, 0x23, 0x11, 0x33,
-    0x15, 0x01, 0xf3, 0x44, 0x47, 0xd8, 0x47, 0x48, 0x44, 0x48, 0xd7, 0x48,
-    0x47, 0x8f, 0x47, 0x8d, 0x48, 0xd0, 0x47, 0x48, 0x44, 0x48, 0xd8, 0x47,
-    0x47, 0x44, 0x47, 0xfe, 0xe1, 0x01, 0x1f, 0x44, 0xfe, 0xe1, 0x44, 0x00,
-    0x00, 0x01, 0x00, 0x41, 0x00, 0x41, 0x01, 0xec, 0x02, 0x33, 0x00, 0x0b,
-    0x00, 0x70, 0x40, 0x30, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x0b, 0x00,
-    0x08, 0x09, 0x02, 0x01, 0x08, 0x03, 0x06, 0x05, 0x03, 0x09, 0x0a, 0x09,
-    0x02, 0x08, 0x07, 0x04, 0x03, 0x03, 0x03, 0x02, 0x04, 0x00, 0x0b, 0x0a,
-    0x04, 0x00, 0x05, 0x04, 0x04, 0x07, 0x06, 0x09, 0x08, 0x01, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01,
-    0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00,
-    0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
-    0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x21, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x33, 0x35, 0x33, 0x11, 0x33, 0x01, 0xec, 0xfe, 0x55, 0x8d, 0x45,
-    0x44, 0x90, 0x8f, 0x41, 0x46, 0x01, 0x1c, 0x49, 0x47, 0xfe, 0x57, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x1b,
-    0x00, 0xb9, 0x40, 0x5e, 0x01, 0x1c, 0x1c, 0x40, 0x1d, 0x00, 0x1a, 0x19,
-    0x04, 0x03, 0x03, 0x18, 0x17, 0x0c, 0x03, 0x0b, 0x0e, 0x0d, 0x03, 0x02,
-    0x01, 0x06, 0x05, 0x03, 0x09, 0x10, 0x0f, 0x03, 0x00, 0x12, 0x11, 0x02,
-    0x1b, 0x08, 0x07, 0x03, 0x00, 0x14, 0x13, 0x02, 0x16, 0x15, 0x0a, 0x03,
-    0x09, 0x1b, 0x1a, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x0e, 0x05, 0x04,
-    0x0b, 0x0a, 0x05, 0x03, 0x04, 0x05, 0x10, 0x0d, 0x03, 0x02, 0x03, 0x0c,
-    0x05, 0x08, 0x07, 0x06, 0x04, 0x08, 0x15, 0x11, 0x10, 0x03, 0x14, 0x04,
-    0x17, 0x16, 0x13, 0x03, 0x12, 0x19, 0x18, 0x01, 0x09, 0x08, 0x00, 0x01,
-    0x09, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f,
-    0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01,
-    0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
-    0x3c, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x09,
-    0x00, 0x1c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
-    0xb9, 0x00, 0x1c, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x23, 0x15,
-    0x23, 0x15, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35,
-    0x33, 0x35, 0x23, 0x15, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x01,
-    0xf3, 0x44, 0x47, 0x91, 0x01, 0x1c, 0xfe, 0x0e, 0x44, 0x48, 0x8e, 0x4a,
-    0xd3, 0x91, 0x44, 0x01, 0x67, 0x47, 0x01, 0x5f, 0x47, 0x48, 0x46, 0x49,
-    0x8d, 0x48, 0x47, 0x48, 0x47, 0x45, 0x45, 0x47, 0x44, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x1b, 0x00, 0xbf,
-    0x40, 0x61, 0x01, 0x1c, 0x1c, 0x40, 0x1d, 0x00, 0x12, 0x11, 0x04, 0x03,
-    0x03, 0x08, 0x0d, 0x1a, 0x19, 0x03, 0x0b, 0x0c, 0x0b, 0x08, 0x03, 0x07,
-    0x02, 0x06, 0x05, 0x1b, 0x14, 0x13, 0x03, 0x00, 0x02, 0x09, 0x0e, 0x0d,
-    0x02, 0x18, 0x0a, 0x09, 0x03, 0x17, 0x10, 0x0f, 0x02, 0x16, 0x15, 0x02,
-    0x03, 0x01, 0x19, 0x18, 0x0e, 0x1a, 0x1b, 0x1a, 0x05, 0x00, 0x17, 0x0f,
-    0x0e, 0x03, 0x16, 0x05, 0x12, 0x09, 0x08, 0x01, 0x03, 0x00, 0x04, 0x02,
-    0x07, 0x06, 0x04, 0x05, 0x04, 0x0d, 0x0c, 0x04, 0x0b, 0x0a, 0x11, 0x10,
-    0x04, 0x12, 0x15, 0x14, 0x04, 0x12, 0x13, 0x12, 0x01, 0x03, 0x02, 0x00,
-    0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x17,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49,
-    0x68, 0xb9, 0x00, 0x05, 0x00, 0x1c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
-    0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x1c, 0xff, 0xc0, 0x38, 0x59, 0x25,
-    0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x15, 0x33, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15,
-    0x33, 0x15, 0x33, 0x01, 0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x8d, 0xd7, 0xd5,
-    0x44, 0x49, 0xd4, 0x01, 0xaa, 0x44, 0x49, 0x46, 0x47, 0x89, 0x48, 0x44,
-    0x49, 0x45, 0x8b, 0x49, 0x48, 0x45, 0x49, 0x45, 0x47, 0x46, 0x48, 0x00,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0f,
-    0x00, 0x15, 0x00, 0x98, 0x40, 0x49, 0x01, 0x16, 0x16, 0x40, 0x17, 0x00,
-    0x0f, 0x00, 0x0a, 0x09, 0x03, 0x0d, 0x02, 0x01, 0x02, 0x03, 0x15, 0x14,
-    0x02, 0x06, 0x05, 0x13, 0x12, 0x0c, 0x03, 0x0b, 0x02, 0x08, 0x07, 0x11,
-    0x04, 0x03, 0x03, 0x10, 0x02, 0x0e, 0x0d, 0x12, 0x09, 0x08, 0x03, 0x11,
-    0x05, 0x0c, 0x14, 0x13, 0x07, 0x03, 0x06, 0x05, 0x0b, 0x0a, 0x01, 0x00,
-    0x04, 0x0e, 0x15, 0x0f, 0x0e, 0x03, 0x10, 0x04, 0x05, 0x04, 0x0d, 0x0c,
-    0x01, 0x03, 0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
-    0x3f, 0x3c, 0x3f, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c,
-    0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x16, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x16, 0xff, 0xc0, 0x38, 0x59,
-    0x25, 0x23, 0x15, 0x23, 0x35, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x33, 0x11, 0x33, 0x07, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0xf3,
-    0x44, 0x90, 0xfe, 0xe2, 0x44, 0x48, 0x47, 0xd8, 0x47, 0xd6, 0x49, 0x44,
-    0xd0, 0x8f, 0x8c, 0x90, 0x48, 0x47, 0x47, 0xfe, 0xe6, 0x01, 0x8c, 0x47,
-    0x45, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33,
-    0x00, 0x13, 0x00, 0x8c, 0x40, 0x40, 0x01, 0x14, 0x14, 0x40, 0x15, 0x00,
-    0x12, 0x11, 0x0e, 0x0d, 0x04, 0x03, 0x02, 0x01, 0x0a, 0x09, 0x02, 0x13,
-    0x00, 0x10, 0x08, 0x07, 0x03, 0x0f, 0x02, 0x0c, 0x0b, 0x06, 0x03, 0x05,
-    0x13, 0x12, 0x05, 0x00, 0x09, 0x08, 0x01, 0x03, 0x00, 0x04, 0x02, 0x07,
-    0x06, 0x04, 0x05, 0x04, 0x0b, 0x0a, 0x04, 0x11, 0x10, 0x0f, 0x0e, 0x04,
-    0x0c, 0x0d, 0x0c, 0x01, 0x03, 0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f,
-    0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59,
-    0x25, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x15, 0x33, 0x35, 0x21,
-    0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x01, 0xf3, 0x44, 0xfe,
-    0x9a, 0x48, 0x8d, 0xd7, 0xfe, 0x9c, 0x01, 0xab, 0xfe, 0xe4, 0x01, 0x1c,
-    0x47, 0x89, 0x48, 0x44, 0x49, 0x45, 0xd3, 0xd7, 0x45, 0x46, 0x47, 0x00,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x13,
-    0x00, 0x17, 0x00, 0xa3, 0x40, 0x4f, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00,
-    0x04, 0x03, 0x02, 0x01, 0x0a, 0x09, 0x03, 0x12, 0x11, 0x0c, 0x03, 0x0b,
-    0x17, 0x16, 0x10, 0x03, 0x0f, 0x02, 0x06, 0x05, 0x0e, 0x0d, 0x02, 0x08,
-    0x07, 0x15, 0x14, 0x02, 0x13, 0x00, 0x05, 0x04, 0x05, 0x06, 0x13, 0x12,
-    0x05, 0x00, 0x0f, 0x07, 0x06, 0x03, 0x0e, 0x05, 0x0a, 0x17, 0x14, 0x01,
-    0x03, 0x00, 0x04, 0x02, 0x0d, 0x09, 0x08, 0x03, 0x0c, 0x04, 0x0a, 0x16,
-    0x15, 0x04, 0x11, 0x10, 0x0b, 0x0a, 0x01, 0x03, 0x02, 0x00, 0x01, 0x05,
-    0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x17,
-    0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49,
-    0x68, 0xb9, 0x00, 0x05, 0x00, 0x18, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
-    0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18, 0xff, 0xc0, 0x38, 0x59, 0x25,
-    0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15,
-    0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x33, 0x07, 0x35, 0x23, 0x15, 0x01,
-    0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x44, 0x48, 0x01, 0x1f, 0xd3, 0x49, 0x01,
-    0x1c, 0x47, 0x8f, 0xd4, 0x89, 0x48, 0x44, 0x01, 0x20, 0x47, 0x47, 0x45,
-    0x47, 0x46, 0x48, 0x90, 0x8d, 0x8d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41,
-    0x01, 0xf3, 0x02, 0x33, 0x00, 0x13, 0x00, 0x8b, 0x40, 0x42, 0x01, 0x14,
-    0x14, 0x40, 0x15, 0x00, 0x06, 0x05, 0x02, 0x07, 0x0a, 0x09, 0x02, 0x04,
-    0x03, 0x0c, 0x0b, 0x02, 0x02, 0x01, 0x0e, 0x0d, 0x02, 0x13, 0x00, 0x10,
-    0x08, 0x07, 0x03, 0x0f, 0x02, 0x12, 0x11, 0x0b, 0x0a, 0x03, 0x03, 0x02,
-    0x05, 0x12, 0x09, 0x08, 0x05, 0x03, 0x04, 0x05, 0x11, 0x10, 0x0d, 0x01,
-    0x00, 0x05, 0x0c, 0x0f, 0x0e, 0x04, 0x12, 0x13, 0x12, 0x01, 0x07, 0x06,
-    0x00, 0x01, 0x11, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
-    0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x00,
-    0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x11, 0x00, 0x14, 0x49, 0x68,
-    0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff,
-    0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x01,
-    0xf3, 0x44, 0x47, 0x48, 0x90, 0x44, 0x47, 0x4a, 0xd3, 0x91, 0x01, 0xf2,
-    0x01, 0xa7, 0x48, 0x47, 0xd7, 0xd5, 0x47, 0x48, 0x47, 0x45, 0x8c, 0x00,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x13,
-    0x00, 0x19, 0x00, 0x1f, 0x00, 0xcd, 0x40, 0x6c, 0x01, 0x20, 0x20, 0x40,
-    0x21, 0x00, 0x02, 0x01, 0x1f, 0x1e, 0x04, 0x03, 0x03, 0x02, 0x05, 0x10,
-    0x0f, 0x02, 0x0d, 0x0c, 0x08, 0x07, 0x03, 0x0b, 0x03, 0x0d, 0x1d, 0x1c,
-    0x19, 0x03, 0x18, 0x03, 0x05, 0x17, 0x16, 0x02, 0x0a, 0x09, 0x06, 0x03,
-    0x05, 0x1b, 0x1a, 0x15, 0x14, 0x12, 0x11, 0x0e, 0x07, 0x0d, 0x02, 0x13,
-    0x00, 0x13, 0x12, 0x05, 0x00, 0x05, 0x04, 0x05, 0x06, 0x09, 0x08, 0x05,
-    0x0a, 0x0f, 0x0e, 0x05, 0x10, 0x19, 0x14, 0x11, 0x03, 0x10, 0x05, 0x1c,
-    0x1b, 0x1e, 0x1d, 0x07, 0x03, 0x06, 0x05, 0x18, 0x17, 0x1f, 0x1a, 0x01,
-    0x03, 0x00, 0x04, 0x02, 0x16, 0x15, 0x0b, 0x03, 0x0a, 0x04, 0x0c, 0x0d,
-    0x0c, 0x01, 0x03, 0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18,
-    0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10,
-    0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01,
-    0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17,
-    0x3c, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05,
-    0x00, 0x20, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
-    0xb9, 0x00, 0x20, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15, 0x21, 0x35,
-    0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x33, 0x27, 0x35, 0x23, 0x15, 0x33, 0x15, 0x17, 0x35, 0x23,
-    0x35, 0x23, 0x15, 0x01, 0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x46, 0x46, 0x44,
-    0x01, 0x1f, 0x48, 0x46, 0x8d, 0x8f, 0xd4, 0x48, 0x8c, 0x8e, 0x8d, 0x89,
-    0x48, 0x44, 0x91, 0x46, 0x90, 0x47, 0x44, 0x90, 0x46, 0x46, 0x8d, 0x49,
-    0x44, 0xd6, 0x49, 0x44, 0x8d, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x41,
-    0x01, 0xf3, 0x02, 0x33, 0x00, 0x13, 0x00, 0x17, 0x00, 0xa3, 0x40, 0x4f,
-    0x01, 0x18, 0x18, 0x40, 0x19, 0x00, 0x12, 0x11, 0x10, 0x0f, 0x04, 0x03,
-    0x03, 0x0c, 0x0b, 0x06, 0x03, 0x05, 0x08, 0x07, 0x02, 0x02, 0x01, 0x15,
-    0x14, 0x0a, 0x03, 0x09, 0x02, 0x13, 0x00, 0x17, 0x16, 0x02, 0x0e, 0x0d,
-    0x13, 0x12, 0x05, 0x00, 0x09, 0x01, 0x00, 0x03, 0x08, 0x05, 0x04, 0x0d,
-    0x0c, 0x05, 0x0e, 0x07, 0x03, 0x02, 0x03, 0x06, 0x04, 0x04, 0x17, 0x14,
-    0x04, 0x0b, 0x0a, 0x16, 0x15, 0x0f, 0x03, 0x0e, 0x04, 0x10, 0x11, 0x10,
-    0x01, 0x05, 0x04, 0x00, 0x01, 0x0d, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
-    0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10,
-    0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0d, 0x00, 0x18,
-    0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
-    0x18, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x07, 0x35, 0x23, 0x15, 0x01, 0xf3, 0x44, 0x47, 0xfe, 0xe1, 0xd2,
-    0x4a, 0xfe, 0xe4, 0x48, 0x44, 0x01, 0x67, 0x47, 0x8f, 0xd4, 0xd0, 0x47,
-    0x48, 0x46, 0x47, 0x46, 0x48, 0x90, 0x47, 0x44, 0x90, 0x8d, 0x8d, 0x00,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0f,
-    0x00, 0x17, 0x00, 0x9e, 0x40, 0x4e, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00,
-    0x0d, 0x0c, 0x0a, 0x09, 0x03, 0x0b, 0x17, 0x04, 0x03, 0x03, 0x16, 0x02,
-    0x06, 0x05, 0x15, 0x14, 0x02, 0x08, 0x07, 0x11, 0x10, 0x0c, 0x02, 0x01,
-    0x05, 0x0b, 0x02, 0x0f, 0x00, 0x13, 0x12, 0x02, 0x0e, 0x0d, 0x12, 0x11,
-    0x0f, 0x03, 0x0e, 0x05, 0x0a, 0x16, 0x07, 0x06, 0x03, 0x15, 0x05, 0x0a,
-    0x17, 0x10, 0x04, 0x03, 0x02, 0x14, 0x13, 0x09, 0x03, 0x08, 0x04, 0x0a,
-    0x0b, 0x0a, 0x01, 0x05, 0x04, 0x01, 0x03, 0x00, 0x00, 0x01, 0x05, 0x46,
-    0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c,
-    0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00,
-    0x18, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
-    0x00, 0x18, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x35, 0x23, 0x15, 0x23,
-    0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x07, 0x35,
-    0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0xf3, 0x8d, 0xd4, 0x91, 0x44,
-    0x48, 0xd7, 0x48, 0x47, 0x8f, 0x47, 0x49, 0x44, 0x41, 0x8e, 0x8e, 0x01,
-    0x64, 0x47, 0x47, 0x44, 0x47, 0x90, 0x90, 0x44, 0x48, 0x8c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x8e, 0x40, 0x43, 0x01, 0x14, 0x14, 0x40, 0x15, 0x00,
-    0x0a, 0x09, 0x06, 0x05, 0x02, 0x01, 0x13, 0x12, 0x0f, 0x03, 0x0e, 0x02,
-    0x04, 0x03, 0x11, 0x10, 0x0d, 0x03, 0x0c, 0x02, 0x0b, 0x08, 0x07, 0x03,
-    0x00, 0x0b, 0x0a, 0x05, 0x00, 0x07, 0x06, 0x05, 0x08, 0x13, 0x10, 0x01,
-    0x03, 0x00, 0x04, 0x02, 0x0e, 0x0d, 0x04, 0x04, 0x12, 0x11, 0x04, 0x0f,
-    0x0c, 0x09, 0x03, 0x08, 0x05, 0x04, 0x01, 0x03, 0x02, 0x00, 0x01, 0x03,
-    0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f, 0x17,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31,
-    0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x03, 0x00, 0x14, 0x49, 0x68, 0x61,
-    0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0,
-    0x38, 0x59, 0x25, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x33, 0x27, 0x35, 0x23, 0x15, 0x17, 0x35, 0x23, 0x15, 0x01, 0xf3,
-    0x44, 0xfe, 0x52, 0x01, 0xab, 0x47, 0x45, 0x45, 0x8f, 0xd4, 0xd4, 0xd4,
-    0x89, 0x48, 0x01, 0xf2, 0x44, 0x90, 0x46, 0x46, 0x8d, 0x8d, 0xd6, 0x8d,
-    0x8d, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33,
-    0x00, 0x1b, 0x00, 0xb5, 0x40, 0x5b, 0x01, 0x1c, 0x1c, 0x40, 0x1d, 0x00,
-    0x11, 0x10, 0x0e, 0x0d, 0x03, 0x05, 0x18, 0x17, 0x03, 0x1a, 0x19, 0x02,
-    0x01, 0x02, 0x00, 0x0a, 0x09, 0x02, 0x1b, 0x0c, 0x0b, 0x03, 0x00, 0x08,
-    0x07, 0x02, 0x12, 0x11, 0x10, 0x0f, 0x06, 0x03, 0x05, 0x02, 0x14, 0x13,
-    0x04, 0x03, 0x02, 0x16, 0x15, 0x07, 0x06, 0x05, 0x0e, 0x15, 0x14, 0x05,
-    0x04, 0x01, 0x05, 0x00, 0x04, 0x1b, 0x1a, 0x17, 0x16, 0x03, 0x03, 0x02,
-    0x04, 0x18, 0x13, 0x12, 0x0b, 0x03, 0x0a, 0x04, 0x08, 0x0d, 0x0c, 0x09,
-    0x03, 0x08, 0x04, 0x0e, 0x19, 0x18, 0x01, 0x0f, 0x0e, 0x00, 0x01, 0x13,
-    0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x00,
-    0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x13, 0x00, 0x1c,
-    0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
-    0x1c, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35,
-    0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x01, 0xf3, 0x8d,
-    0x8d, 0x49, 0x46, 0x8d, 0x90, 0x44, 0xfe, 0xe1, 0x47, 0x48, 0x44, 0x48,
-    0x01, 0x1f, 0x47, 0x01, 0xa7, 0x45, 0x45, 0xd5, 0x49, 0x45, 0x45, 0x48,
-    0x44, 0x48, 0xd8, 0x47, 0x47, 0x44, 0x00, 0x02, 0x00, 0x01, 0x00, 0x41,
-    0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x8f, 0x40, 0x43,
-    0x01, 0x14, 0x14, 0x40, 0x15, 0x00, 0x09, 0x08, 0x04, 0x03, 0x11, 0x10,
-    0x02, 0x06, 0x05, 0x0d, 0x0c, 0x08, 0x03, 0x07, 0x02, 0x0b, 0x00, 0x0f,
-    0x0e, 0x02, 0x0a, 0x09, 0x13, 0x12, 0x02, 0x02, 0x01, 0x13, 0x0c, 0x01,
-    0x03, 0x00, 0x05, 0x04, 0x0e, 0x0d, 0x0b, 0x03, 0x0a, 0x05, 0x06, 0x12,
-    0x11, 0x03, 0x03, 0x02, 0x04, 0x04, 0x10, 0x0f, 0x04, 0x06, 0x07, 0x06,
-    0x01, 0x05, 0x04, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
-    0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10,
-    0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
-    0x00, 0x05, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
-    0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15,
-    0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x07, 0x35, 0x23,
-    0x35, 0x23, 0x11, 0x33, 0x35, 0x01, 0xf3, 0x44, 0x47, 0xfe, 0x99, 0x01,
-    0x63, 0x48, 0x47, 0x8f, 0x47, 0x8d, 0x90, 0xd0, 0x47, 0x48, 0x01, 0xf2,
-    0x44, 0x47, 0xd8, 0xd8, 0x44, 0xfe, 0x9d, 0x47, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x45, 0x01, 0xfc, 0x02, 0x3c, 0x00, 0x0b, 0x00, 0x67, 0x40, 0x2a,
-    0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x0b, 0x08, 0x07, 0x04, 0x03, 0x00,
-    0x0a, 0x09, 0x06, 0x03, 0x05, 0x02, 0x02, 0x01, 0x0b, 0x0a, 0x04, 0x00,
-    0x05, 0x04, 0x04, 0x02, 0x09, 0x08, 0x04, 0x07, 0x06, 0x03, 0x02, 0x01,
-    0x01, 0x00, 0x00, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
-    0x3c, 0x3f, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x0c,
-    0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
-    0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x21, 0x01, 0xfc, 0xfe, 0x08, 0x01, 0xf8, 0xfe,
-    0x99, 0xd7, 0xd7, 0x01, 0x67, 0x45, 0x01, 0xf7, 0x46, 0x8f, 0x4a, 0x8f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x09,
-    0x00, 0x5c, 0x40, 0x24, 0x01, 0x0a, 0x0a, 0x40, 0x0b, 0x00, 0x09, 0x04,
-    0x03, 0x00, 0x06, 0x02, 0x01, 0x03, 0x05, 0x02, 0x08, 0x07, 0x01, 0x00,
-    0x04, 0x08, 0x05, 0x04, 0x04, 0x03, 0x02, 0x09, 0x08, 0x01, 0x07, 0x06,
-    0x00, 0x01, 0x07, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd,
-    0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
-    0xb9, 0x00, 0x07, 0x00, 0x0a, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
-    0x38, 0x11, 0x37, 0xb9, 0x00, 0x0a, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x15, 0x23, 0x11, 0x21, 0x01, 0xf3, 0xfe, 0x9d,
-    0x01, 0x1c, 0xfe, 0xe6, 0x91, 0x01, 0xf2, 0x01, 0xee, 0x8d, 0x49, 0xd7,
-    0x01, 0xf2, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33,
-    0x00, 0x17, 0x00, 0xa9, 0x40, 0x52, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00,
-    0x0a, 0x09, 0x16, 0x15, 0x03, 0x00, 0x12, 0x11, 0x02, 0x04, 0x03, 0x10,
-    0x0f, 0x02, 0x03, 0x01, 0x02, 0x06, 0x05, 0x0e, 0x0d, 0x02, 0x08, 0x07,
-    0x14, 0x13, 0x02, 0x17, 0x0c, 0x0b, 0x03, 0x00, 0x05, 0x04, 0x0e, 0x14,
-    0x03, 0x02, 0x0e, 0x14, 0x11, 0x10, 0x05, 0x00, 0x0f, 0x07, 0x06, 0x03,
-    0x0e, 0x05, 0x0a, 0x13, 0x12, 0x04, 0x00, 0x0d, 0x09, 0x08, 0x03, 0x0c,
-    0x04, 0x0a, 0x17, 0x16, 0x04, 0x15, 0x14, 0x0b, 0x0a, 0x01, 0x01, 0x00,
-    0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2e,
-    0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x18,
-    0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
-    0x18, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x35, 0x23, 0x35, 0x33, 0x01, 0xf3, 0xfe, 0x9d, 0x47, 0x48, 0x44,
-    0x48, 0x01, 0x66, 0xfe, 0xe6, 0x49, 0x46, 0x8f, 0x46, 0xd4, 0x41, 0x44,
-    0x48, 0xd8, 0x47, 0x47, 0x45, 0x47, 0xd5, 0x49, 0x8b, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x68,
-    0x40, 0x2c, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x02, 0x01, 0x02, 0x00,
-    0x04, 0x03, 0x02, 0x05, 0x08, 0x07, 0x02, 0x06, 0x05, 0x0a, 0x09, 0x02,
-    0x0b, 0x00, 0x03, 0x02, 0x04, 0x09, 0x08, 0x0b, 0x0a, 0x07, 0x03, 0x06,
-    0x01, 0x05, 0x04, 0x01, 0x03, 0x00, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f,
-    0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
-    0x05, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
-    0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x35, 0x23,
-    0x15, 0x23, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x01, 0xf3, 0x8d, 0xd4,
-    0x91, 0x8d, 0xd5, 0x90, 0x41, 0xd5, 0xd5, 0x01, 0xf2, 0xd4, 0xd4, 0x00,
-    0x00, 0x01, 0x00, 0x33, 0x00, 0x41, 0x01, 0xde, 0x02, 0x33, 0x00, 0x0b,
-    0x00, 0x72, 0x40, 0x32, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x0b, 0x08,
-    0x07, 0x03, 0x00, 0x08, 0x09, 0x06, 0x05, 0x02, 0x03, 0x01, 0x03, 0x09,
-    0x0a, 0x09, 0x02, 0x04, 0x03, 0x03, 0x02, 0x04, 0x00, 0x0b, 0x0a, 0x04,
-    0x00, 0x05, 0x04, 0x04, 0x06, 0x09, 0x08, 0x04, 0x06, 0x07, 0x06, 0x01,
-    0x01, 0x00, 0x00, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
-    0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c,
-    0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
-    0x01, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
-    0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x21, 0x35, 0x33,
-    0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x01, 0xde, 0xfe, 0x55,
-    0x8d, 0x8d, 0x01, 0xab, 0x8d, 0x8d, 0x41, 0x46, 0x01, 0x63, 0x49, 0x45,
-    0xfe, 0x9c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33,
-    0x00, 0x0b, 0x00, 0x65, 0x40, 0x29, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00,
-    0x04, 0x03, 0x02, 0x01, 0x08, 0x07, 0x02, 0x06, 0x05, 0x0a, 0x09, 0x02,
-    0x0b, 0x00, 0x09, 0x08, 0x01, 0x03, 0x00, 0x04, 0x02, 0x07, 0x06, 0x04,
-    0x05, 0x04, 0x0b, 0x0a, 0x01, 0x03, 0x02, 0x00, 0x01, 0x05, 0x46, 0x76,
-    0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
-    0x00, 0x05, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
-    0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x35, 0x33, 0x15, 0x33, 0x11, 0x33, 0x01, 0xf3, 0x44,
-    0xfe, 0x9a, 0x48, 0x8d, 0xd8, 0x8d, 0x89, 0x48, 0x44, 0x49, 0x45, 0x01,
-    0xaa, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33,
-    0x00, 0x1d, 0x00, 0xca, 0x40, 0x68, 0x01, 0x1e, 0x1e, 0x40, 0x1f, 0x00,
-    0x04, 0x03, 0x03, 0x1c, 0x1b, 0x18, 0x17, 0x02, 0x03, 0x01, 0x03, 0x07,
-    0x06, 0x05, 0x02, 0x07, 0x0a, 0x09, 0x02, 0x08, 0x07, 0x0c, 0x0b, 0x02,
-    0x16, 0x15, 0x0e, 0x0d, 0x02, 0x14, 0x13, 0x1a, 0x19, 0x10, 0x03, 0x0f,
-    0x02, 0x1d, 0x12, 0x11, 0x03, 0x00, 0x03, 0x02, 0x0e, 0x04, 0x19, 0x18,
-    0x05, 0x00, 0x1b, 0x1a, 0x05, 0x00, 0x05, 0x04, 0x05, 0x0a, 0x15, 0x0d,
-    0x0c, 0x03, 0x14, 0x05, 0x08, 0x17, 0x16, 0x0b, 0x03, 0x0a, 0x05, 0x0e,
-    0x1d, 0x1c, 0x04, 0x00, 0x13, 0x0f, 0x0e, 0x03, 0x12, 0x04, 0x08, 0x11,
-    0x10, 0x09, 0x03, 0x08, 0x01, 0x07, 0x06, 0x01, 0x03, 0x00, 0x00, 0x01,
-    0x07, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17,
-    0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x00, 0x31,
-    0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x07, 0x00, 0x1e, 0x49, 0x68, 0x61,
-    0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x1e, 0xff, 0xc0,
-    0x38, 0x59, 0x25, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x33,
-    0x15, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x01, 0xf3, 0xd4, 0x47,
-    0x46, 0x91, 0x8d, 0x46, 0x47, 0x48, 0x90, 0x44, 0x47, 0x49, 0x45, 0x48,
-    0x47, 0x41, 0x44, 0x4a, 0x8e, 0x01, 0xf2, 0xd4, 0x46, 0x47, 0x47, 0x45,
-    0x47, 0x48, 0x46, 0x47, 0x48, 0x00, 0x00, 0x01, 0xff, 0xdd, 0x00, 0x41,
-    0x01, 0x88, 0x02, 0x33, 0x00, 0x05, 0x00, 0x4b, 0x40, 0x1a, 0x01, 0x06,
-    0x06, 0x40, 0x07, 0x00, 0x05, 0x00, 0x04, 0x03, 0x02, 0x02, 0x01, 0x05,
-    0x04, 0x04, 0x00, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x46,
-    0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c,
-    0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49,
-    0x68, 0xb9, 0x00, 0x01, 0x00, 0x06, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
-    0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x06, 0xff, 0xc0, 0x38, 0x59, 0x25,
-    0x21, 0x11, 0x33, 0x11, 0x21, 0x01, 0x88, 0xfe, 0x55, 0x8d, 0x01, 0x1e,
-    0x41, 0x01, 0xf2, 0xfe, 0x57, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41,
-    0x01, 0xf3, 0x02, 0x33, 0x00, 0x13, 0x00, 0x95, 0x40, 0x47, 0x01, 0x14,
-    0x14, 0x40, 0x15, 0x00, 0x04, 0x03, 0x02, 0x05, 0x0e, 0x06, 0x05, 0x03,
-    0x0d, 0x03, 0x09, 0x10, 0x0f, 0x03, 0x00, 0x02, 0x01, 0x02, 0x00, 0x08,
-    0x07, 0x02, 0x09, 0x0c, 0x0b, 0x02, 0x0a, 0x09, 0x12, 0x11, 0x02, 0x13,
-    0x00, 0x11, 0x10, 0x05, 0x02, 0x05, 0x04, 0x05, 0x0f, 0x0e, 0x07, 0x06,
-    0x03, 0x03, 0x02, 0x05, 0x0d, 0x0c, 0x13, 0x12, 0x0b, 0x03, 0x0a, 0x01,
-    0x09, 0x08, 0x01, 0x03, 0x00, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37,
-    0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x31, 0x30,
-    0x01, 0x49, 0x68, 0xb9, 0x00, 0x09, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0,
-    0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38,
-    0x59, 0x25, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11,
-    0x33, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x33, 0x01, 0xf3, 0x8d,
-    0x46, 0x48, 0x46, 0x91, 0x8d, 0x48, 0x45, 0x48, 0x90, 0x41, 0xd5, 0x46,
-    0x46, 0xd5, 0x01, 0xf2, 0x44, 0x49, 0x46, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x13, 0x00, 0x90, 0x40, 0x44,
-    0x01, 0x14, 0x14, 0x40, 0x15, 0x00, 0x10, 0x0f, 0x04, 0x03, 0x03, 0x03,
-    0x00, 0x0e, 0x06, 0x05, 0x03, 0x0d, 0x03, 0x09, 0x02, 0x01, 0x02, 0x00,
-    0x08, 0x07, 0x02, 0x09, 0x0c, 0x0b, 0x02, 0x0a, 0x09, 0x12, 0x11, 0x02,
-    0x13, 0x00, 0x11, 0x10, 0x05, 0x03, 0x02, 0x05, 0x04, 0x05, 0x0f, 0x0e,
-    0x07, 0x06, 0x05, 0x0d, 0x0c, 0x13, 0x12, 0x0b, 0x03, 0x0a, 0x01, 0x09,
-    0x08, 0x01, 0x03, 0x00, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37, 0x18,
-    0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
-    0xb9, 0x00, 0x09, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
-    0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23,
-    0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x33, 0x15, 0x33,
-    0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x01, 0xf3, 0x8d, 0x47, 0x47, 0x46,
-    0x91, 0x8d, 0x48, 0x47, 0x46, 0x90, 0x41, 0x44, 0x48, 0x49, 0xd5, 0x01,
-    0xf2, 0x44, 0x47, 0x49, 0xd4, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x41,
-    0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x77, 0x40, 0x33,
-    0x01, 0x10, 0x10, 0x40, 0x11, 0x00, 0x0b, 0x0a, 0x05, 0x04, 0x0a, 0x09,
-    0x08, 0x07, 0x04, 0x03, 0x02, 0x01, 0x0f, 0x0e, 0x02, 0x06, 0x05, 0x0d,
-    0x0c, 0x02, 0x0b, 0x00, 0x0f, 0x0c, 0x01, 0x03, 0x00, 0x04, 0x02, 0x0e,
-    0x0d, 0x07, 0x03, 0x06, 0x04, 0x08, 0x09, 0x08, 0x01, 0x03, 0x02, 0x00,
-    0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
-    0x00, 0x05, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
-    0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x03, 0x11, 0x23,
-    0x11, 0x01, 0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x44, 0x01, 0x67, 0x47, 0x8f,
-    0xd4, 0x89, 0x48, 0x44, 0x01, 0x67, 0x47, 0x44, 0xfe, 0x9a, 0x01, 0x63,
-    0xfe, 0x9d, 0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x70, 0x40, 0x30, 0x01, 0x0e, 0x0e, 0x40,
-    0x0f, 0x00, 0x08, 0x07, 0x02, 0x01, 0x0d, 0x04, 0x03, 0x03, 0x0c, 0x02,
-    0x06, 0x05, 0x0b, 0x0a, 0x02, 0x09, 0x00, 0x09, 0x08, 0x05, 0x00, 0x0d,
-    0x0a, 0x01, 0x03, 0x00, 0x04, 0x03, 0x02, 0x0c, 0x0b, 0x04, 0x06, 0x07,
-    0x06, 0x01, 0x05, 0x04, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18,
-    0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17,
-    0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
-    0xb9, 0x00, 0x05, 0x00, 0x0e, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
-    0x38, 0x11, 0x37, 0xb9, 0x00, 0x0e, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x23,
-    0x15, 0x21, 0x15, 0x23, 0x11, 0x21, 0x15, 0x33, 0x07, 0x35, 0x23, 0x15,
-    0x01, 0xf3, 0x44, 0xfe, 0xe3, 0x91, 0x01, 0xab, 0x47, 0x8f, 0xd4, 0x01,
-    0x18, 0x48, 0x8f, 0x01, 0xf2, 0x44, 0xd7, 0xd4, 0xd4, 0x00, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x11, 0x00, 0x19,
-    0x00, 0xa6, 0x40, 0x52, 0x01, 0x1a, 0x1a, 0x40, 0x1b, 0x00, 0x0b, 0x0a,
-    0x07, 0x06, 0x0e, 0x0d, 0x08, 0x07, 0x03, 0x0a, 0x09, 0x19, 0x18, 0x03,
-    0x00, 0x15, 0x14, 0x02, 0x0c, 0x0b, 0x13, 0x12, 0x02, 0x11, 0x04, 0x03,
-    0x03, 0x00, 0x17, 0x16, 0x02, 0x10, 0x0f, 0x06, 0x05, 0x02, 0x05, 0x01,
-    0x11, 0x10, 0x05, 0x00, 0x16, 0x15, 0x03, 0x03, 0x02, 0x04, 0x04, 0x14,
-    0x13, 0x0d, 0x03, 0x0c, 0x04, 0x0e, 0x19, 0x12, 0x04, 0x18, 0x01, 0x00,
-    0x03, 0x17, 0x0f, 0x0e, 0x01, 0x09, 0x08, 0x05, 0x03, 0x04, 0x00, 0x01,
-    0x0b, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c,
-    0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17,
-    0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x17,
-    0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x0b, 0x00, 0x1a, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x1a, 0xff, 0xc0, 0x38, 0x59,
-    0x25, 0x23, 0x15, 0x33, 0x15, 0x23, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x07, 0x35, 0x23, 0x11, 0x33, 0x35,
-    0x23, 0x35, 0x01, 0xf3, 0x45, 0x45, 0x45, 0x46, 0xfe, 0xe1, 0x48, 0x44,
-    0x01, 0x67, 0x47, 0x8f, 0xd4, 0x8d, 0x46, 0xd0, 0x46, 0x49, 0x46, 0x46,
-    0x44, 0x01, 0x67, 0x47, 0x44, 0xd7, 0xd4, 0xfe, 0x9d, 0x49, 0x46, 0x00,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x11,
-    0x00, 0x17, 0x00, 0xa8, 0x40, 0x54, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00,
-    0x17, 0x16, 0x08, 0x03, 0x07, 0x03, 0x00, 0x0a, 0x09, 0x03, 0x10, 0x0f,
-    0x04, 0x03, 0x03, 0x15, 0x0c, 0x0b, 0x03, 0x14, 0x02, 0x0e, 0x0d, 0x13,
-    0x02, 0x01, 0x03, 0x12, 0x02, 0x11, 0x06, 0x05, 0x03, 0x00, 0x17, 0x12,
-    0x05, 0x06, 0x11, 0x10, 0x05, 0x00, 0x03, 0x02, 0x05, 0x06, 0x09, 0x08,
-    0x05, 0x00, 0x05, 0x04, 0x04, 0x06, 0x16, 0x15, 0x01, 0x03, 0x00, 0x04,
-    0x0b, 0x0a, 0x14, 0x13, 0x04, 0x0e, 0x0f, 0x0e, 0x01, 0x0d, 0x0c, 0x07,
-    0x03, 0x06, 0x00, 0x01, 0x0d, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
-    0x17, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c,
-    0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0d, 0x00, 0x18, 0x49,
-    0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18,
-    0xff, 0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23,
-    0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x21, 0x15, 0x33, 0x07, 0x35,
-    0x23, 0x15, 0x33, 0x35, 0x01, 0xf3, 0x8d, 0x46, 0x47, 0xd4, 0x47, 0x46,
-    0x91, 0x01, 0xab, 0x47, 0x8f, 0xd4, 0x90, 0x01, 0x18, 0x46, 0x48, 0x49,
-    0x44, 0x4a, 0x8e, 0x01, 0xf2, 0x44, 0x90, 0x8d, 0xd4, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x1b, 0x00, 0xb4,
-    0x40, 0x59, 0x01, 0x1c, 0x1c, 0x40, 0x1d, 0x00, 0x0c, 0x0b, 0x04, 0x03,
-    0x02, 0x01, 0x10, 0x0f, 0x03, 0x11, 0x12, 0x11, 0x0a, 0x03, 0x09, 0x02,
-    0x1b, 0x00, 0x18, 0x08, 0x07, 0x03, 0x17, 0x02, 0x0e, 0x0d, 0x06, 0x03,
-    0x05, 0x16, 0x15, 0x02, 0x1a, 0x19, 0x14, 0x03, 0x13, 0x1b, 0x1a, 0x05,
-    0x00, 0x0d, 0x0c, 0x05, 0x0e, 0x09, 0x08, 0x01, 0x03, 0x00, 0x04, 0x02,
-    0x07, 0x06, 0x04, 0x05, 0x04, 0x0b, 0x0a, 0x04, 0x19, 0x18, 0x15, 0x14,
-    0x04, 0x13, 0x12, 0x17, 0x16, 0x0f, 0x03, 0x0e, 0x04, 0x10, 0x11, 0x10,
-    0x01, 0x03, 0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
-    0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x3c,
-    0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10,
-    0xfd, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x1c, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x1c, 0xff, 0xc0, 0x38, 0x59,
-    0x25, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x15, 0x33, 0x35, 0x21,
-    0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x35, 0x23,
-    0x15, 0x21, 0x15, 0x33, 0x01, 0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x8d, 0xd7,
-    0xfe, 0xe4, 0x48, 0x44, 0x01, 0x1f, 0x48, 0x8d, 0x8f, 0x01, 0x1c, 0x47,
-    0x89, 0x48, 0x44, 0x49, 0x45, 0x8b, 0x48, 0x90, 0x47, 0x44, 0x48, 0x45,
-    0x8b, 0x48, 0x00, 0x01, 0xff, 0xdd, 0x00, 0x41, 0x01, 0x88, 0x02, 0x33,
-    0x00, 0x07, 0x00, 0x5c, 0x40, 0x24, 0x01, 0x08, 0x08, 0x40, 0x09, 0x00,
-    0x07, 0x00, 0x08, 0x01, 0x06, 0x05, 0x03, 0x01, 0x04, 0x03, 0x02, 0x02,
-    0x01, 0x01, 0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x06, 0x07, 0x06, 0x01,
-    0x03, 0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
-    0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x08, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0, 0x38, 0x59,
-    0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x21, 0x01, 0x88, 0x8c, 0x90,
-    0x8f, 0x01, 0xab, 0x01, 0xee, 0xfe, 0x53, 0x01, 0xa9, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x64,
-    0x40, 0x29, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x05, 0x04, 0x04, 0x03,
-    0x02, 0x01, 0x08, 0x07, 0x02, 0x06, 0x05, 0x0a, 0x09, 0x02, 0x0b, 0x00,
-    0x09, 0x08, 0x01, 0x03, 0x00, 0x04, 0x02, 0x0b, 0x0a, 0x07, 0x03, 0x06,
-    0x01, 0x03, 0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
-    0x3f, 0x3c, 0x3f, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e,
-    0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x0c, 0x49,
-    0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c,
-    0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x01, 0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x8d, 0xd5,
-    0x90, 0x89, 0x48, 0x44, 0x01, 0xae, 0xfe, 0x56, 0x01, 0xaa, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x17, 0x00, 0xab,
-    0x40, 0x53, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00, 0x0b, 0x0a, 0x03, 0x02,
-    0x04, 0x03, 0x08, 0x05, 0x02, 0x01, 0x08, 0x05, 0x0c, 0x0b, 0x08, 0x07,
-    0x06, 0x05, 0x02, 0x07, 0x12, 0x08, 0x07, 0x03, 0x11, 0x03, 0x0d, 0x14,
-    0x13, 0x03, 0x00, 0x10, 0x0a, 0x09, 0x03, 0x0f, 0x02, 0x0e, 0x0d, 0x16,
-    0x15, 0x02, 0x17, 0x00, 0x0d, 0x0c, 0x05, 0x0e, 0x15, 0x14, 0x05, 0x05,
-    0x04, 0x13, 0x01, 0x00, 0x03, 0x12, 0x05, 0x06, 0x11, 0x10, 0x05, 0x09,
-    0x08, 0x17, 0x16, 0x0f, 0x03, 0x0e, 0x01, 0x07, 0x06, 0x00, 0x01, 0x0d,
-    0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x17, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0d, 0x00, 0x18, 0x49, 0x68,
-    0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18, 0xff,
-    0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35,
-    0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x33, 0x35,
-    0x33, 0x35, 0x33, 0x01, 0xf3, 0x44, 0x47, 0x48, 0x48, 0x48, 0x47, 0x48,
-    0x8d, 0x48, 0x45, 0x48, 0x90, 0x01, 0x18, 0x48, 0x47, 0x48, 0x44, 0x48,
-    0x47, 0x01, 0x1f, 0xd2, 0x4a, 0x46, 0xd6, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x13, 0x00, 0x95, 0x40, 0x47,
-    0x01, 0x14, 0x14, 0x40, 0x15, 0x00, 0x0e, 0x0d, 0x02, 0x0f, 0x10, 0x0f,
-    0x04, 0x03, 0x03, 0x03, 0x00, 0x06, 0x05, 0x03, 0x09, 0x02, 0x01, 0x02,
-    0x00, 0x08, 0x07, 0x02, 0x09, 0x0c, 0x0b, 0x02, 0x0a, 0x09, 0x12, 0x11,
-    0x02, 0x13, 0x00, 0x03, 0x02, 0x05, 0x0c, 0x0f, 0x0e, 0x05, 0x05, 0x04,
-    0x11, 0x10, 0x0d, 0x03, 0x0c, 0x05, 0x07, 0x06, 0x13, 0x12, 0x0b, 0x03,
-    0x0a, 0x01, 0x09, 0x08, 0x01, 0x03, 0x00, 0x00, 0x01, 0x09, 0x46, 0x76,
-    0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x00,
-    0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x09, 0x00, 0x14, 0x49, 0x68,
-    0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff,
-    0xc0, 0x38, 0x59, 0x25, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15,
-    0x23, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x01,
-    0xf3, 0x8d, 0x47, 0x46, 0x47, 0x91, 0x8d, 0x46, 0x49, 0x46, 0x90, 0x41,
-    0x44, 0x4a, 0x46, 0x48, 0x01, 0xf2, 0xd4, 0x45, 0x45, 0xd4, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x23, 0x00, 0xe5,
-    0x40, 0x75, 0x01, 0x24, 0x24, 0x40, 0x25, 0x00, 0x21, 0x20, 0x19, 0x18,
-    0x15, 0x14, 0x07, 0x06, 0x03, 0x02, 0x22, 0x21, 0x1e, 0x1d, 0x10, 0x0f,
-    0x0c, 0x0b, 0x04, 0x03, 0x06, 0x05, 0x03, 0x09, 0x16, 0x15, 0x03, 0x09,
-    0x18, 0x17, 0x03, 0x00, 0x20, 0x1f, 0x02, 0x03, 0x01, 0x02, 0x00, 0x08,
-    0x07, 0x02, 0x09, 0x14, 0x13, 0x0e, 0x03, 0x0d, 0x02, 0x12, 0x11, 0x0a,
-    0x03, 0x09, 0x1a, 0x19, 0x02, 0x23, 0x1c, 0x1b, 0x03, 0x00, 0x0d, 0x0c,
-    0x05, 0x00, 0x0f, 0x0e, 0x05, 0x12, 0x1f, 0x1e, 0x05, 0x12, 0x23, 0x22,
-    0x05, 0x00, 0x0b, 0x05, 0x04, 0x03, 0x0a, 0x05, 0x00, 0x11, 0x10, 0x05,
-    0x12, 0x1d, 0x17, 0x16, 0x03, 0x1c, 0x05, 0x12, 0x1b, 0x1a, 0x13, 0x03,
-    0x12, 0x01, 0x09, 0x08, 0x01, 0x03, 0x00, 0x00, 0x01, 0x09, 0x46, 0x76,
-    0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17,
-    0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30,
-    0x01, 0x49, 0x68, 0xb9, 0x00, 0x09, 0x00, 0x24, 0x49, 0x68, 0x61, 0xb0,
-    0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x24, 0xff, 0xc0, 0x38,
-    0x59, 0x25, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x01, 0xf3, 0x8d, 0x47, 0x46, 0x47, 0x91, 0x44, 0x49, 0x45, 0x48,
-    0x8d, 0x48, 0x45, 0x48, 0x90, 0x44, 0x49, 0x46, 0x47, 0x41, 0x44, 0x4a,
-    0x46, 0x48, 0x8d, 0x48, 0x46, 0x47, 0x90, 0x44, 0x49, 0x46, 0x47, 0x8c,
-    0x48, 0x46, 0x47, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x41, 0x01, 0xcf,
-    0x02, 0x33, 0x00, 0x0f, 0x00, 0x81, 0x40, 0x3b, 0x01, 0x10, 0x10, 0x40,
-    0x11, 0x00, 0x08, 0x07, 0x03, 0x02, 0x01, 0x04, 0x03, 0x02, 0x05, 0x0c,
-    0x06, 0x05, 0x03, 0x0b, 0x02, 0x0a, 0x09, 0x0e, 0x0d, 0x02, 0x0f, 0x00,
-    0x03, 0x02, 0x05, 0x0a, 0x07, 0x06, 0x05, 0x0a, 0x0d, 0x0c, 0x01, 0x03,
-    0x00, 0x05, 0x0a, 0x09, 0x08, 0x05, 0x0a, 0x0f, 0x0e, 0x0b, 0x03, 0x0a,
-    0x01, 0x05, 0x04, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
-    0x3f, 0x3c, 0x3f, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x00,
-    0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x09, 0x00, 0x10, 0x49, 0x68,
-    0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff,
-    0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35,
-    0x23, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x01, 0xcf, 0x44, 0x47, 0x91,
-    0x47, 0x48, 0x8d, 0x8e, 0x90, 0x01, 0x5f, 0x47, 0xd7, 0xd3, 0x48, 0xd7,
-    0xd4, 0xd4, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33,
-    0x00, 0x17, 0x00, 0xa6, 0x40, 0x52, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00,
-    0x08, 0x07, 0x03, 0x16, 0x15, 0x0c, 0x03, 0x0b, 0x06, 0x05, 0x03, 0x0e,
-    0x0d, 0x10, 0x0f, 0x03, 0x04, 0x03, 0x12, 0x11, 0x03, 0x02, 0x01, 0x14,
-    0x13, 0x03, 0x17, 0x0a, 0x09, 0x03, 0x00, 0x11, 0x10, 0x03, 0x03, 0x02,
-    0x05, 0x16, 0x0f, 0x05, 0x04, 0x03, 0x0e, 0x05, 0x0a, 0x13, 0x12, 0x01,
-    0x03, 0x00, 0x05, 0x16, 0x0d, 0x07, 0x06, 0x03, 0x0c, 0x05, 0x0a, 0x09,
-    0x08, 0x04, 0x0a, 0x15, 0x14, 0x04, 0x16, 0x17, 0x16, 0x01, 0x0b, 0x0a,
-    0x00, 0x01, 0x0b, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
-    0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10,
-    0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01,
-    0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x00, 0x31,
-    0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0b, 0x00, 0x18, 0x49, 0x68, 0x61,
-    0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18, 0xff, 0xc0,
-    0x38, 0x59, 0x01, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21,
-    0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x35, 0x21, 0x01, 0xf3, 0x44, 0x47, 0x48, 0x49, 0x01, 0x1c, 0xfe, 0x0e,
-    0x44, 0x48, 0x47, 0x49, 0xfe, 0xe4, 0x01, 0xf2, 0x01, 0xa7, 0x48, 0x47,
-    0x48, 0x46, 0x49, 0x8d, 0x48, 0x47, 0x48, 0x45, 0x49, 0x00, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0f, 0x00, 0x17,
-    0x00, 0x9e, 0x40, 0x4e, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00, 0x0d, 0x0c,
-    0x0a, 0x09, 0x03, 0x0b, 0x17, 0x04, 0x03, 0x03, 0x16, 0x02, 0x06, 0x05,
-    0x15, 0x14, 0x02, 0x08, 0x07, 0x11, 0x10, 0x0c, 0x02, 0x01, 0x05, 0x0b,
-    0x02, 0x0f, 0x00, 0x13, 0x12, 0x02, 0x0e, 0x0d, 0x12, 0x11, 0x0f, 0x03,
-    0x0e, 0x05, 0x0a, 0x16, 0x07, 0x06, 0x03, 0x15, 0x05, 0x0a, 0x17, 0x10,
-    0x04, 0x03, 0x02, 0x14, 0x13, 0x09, 0x03, 0x08, 0x04, 0x0a, 0x0b, 0x0a,
-    0x01, 0x05, 0x04, 0x01, 0x03, 0x00, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f,
-    0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x2e,
-    0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x18, 0x49,
-    0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18,
-    0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x07, 0x35, 0x23, 0x35,
-    0x23, 0x15, 0x23, 0x15, 0x01, 0xf3, 0x8d, 0xd4, 0x91, 0x44, 0x48, 0xd7,
-    0x48, 0x47, 0x8f, 0x47, 0x49, 0x44, 0x41, 0x8e, 0x8e, 0x01, 0x64, 0x47,
-    0x47, 0x44, 0x47, 0x90, 0x90, 0x44, 0x48, 0x8c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x8e, 0x40, 0x43, 0x01, 0x14, 0x14, 0x40, 0x15, 0x00, 0x0a, 0x09,
-    0x06, 0x05, 0x02, 0x01, 0x13, 0x12, 0x0f, 0x03, 0x0e, 0x02, 0x04, 0x03,
-    0x11, 0x10, 0x0d, 0x03, 0x0c, 0x02, 0x0b, 0x08, 0x07, 0x03, 0x00, 0x0b,
-    0x0a, 0x05, 0x00, 0x07, 0x06, 0x05, 0x08, 0x13, 0x10, 0x01, 0x03, 0x00,
-    0x04, 0x02, 0x0e, 0x0d, 0x04, 0x04, 0x12, 0x11, 0x04, 0x0f, 0x0c, 0x09,
-    0x03, 0x08, 0x05, 0x04, 0x01, 0x03, 0x02, 0x00, 0x01, 0x03, 0x46, 0x76,
-    0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x03, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59,
-    0x25, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33,
-    0x27, 0x35, 0x23, 0x15, 0x17, 0x35, 0x23, 0x15, 0x01, 0xf3, 0x44, 0xfe,
-    0x52, 0x01, 0xab, 0x47, 0x45, 0x45, 0x8f, 0xd4, 0xd4, 0xd4, 0x89, 0x48,
-    0x01, 0xf2, 0x44, 0x90, 0x46, 0x46, 0x8d, 0x8d, 0xd6, 0x8d, 0x8d, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x1b,
-    0x00, 0xb5, 0x40, 0x5b, 0x01, 0x1c, 0x1c, 0x40, 0x1d, 0x00, 0x11, 0x10,
-    0x0e, 0x0d, 0x03, 0x05, 0x18, 0x17, 0x03, 0x1a, 0x19, 0x02, 0x01, 0x02,
-    0x00, 0x0a, 0x09, 0x02, 0x1b, 0x0c, 0x0b, 0x03, 0x00, 0x08, 0x07, 0x02,
-    0x12, 0x11, 0x10, 0x0f, 0x06, 0x03, 0x05, 0x02, 0x14, 0x13, 0x04, 0x03,
-    0x02, 0x16, 0x15, 0x07, 0x06, 0x05, 0x0e, 0x15, 0x14, 0x05, 0x04, 0x01,
-    0x05, 0x00, 0x04, 0x1b, 0x1a, 0x17, 0x16, 0x03, 0x03, 0x02, 0x04, 0x18,
-    0x13, 0x12, 0x0b, 0x03, 0x0a, 0x04, 0x08, 0x0d, 0x0c, 0x09, 0x03, 0x08,
-    0x04, 0x0e, 0x19, 0x18, 0x01, 0x0f, 0x0e, 0x00, 0x01, 0x13, 0x46, 0x76,
-    0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17,
-    0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x2e, 0x2e,
-    0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x13, 0x00, 0x1c, 0x49, 0x68,
-    0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x1c, 0xff,
-    0xc0, 0x38, 0x59, 0x01, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x35, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x01, 0xf3, 0x8d, 0x8d, 0x49,
-    0x46, 0x8d, 0x90, 0x44, 0xfe, 0xe1, 0x47, 0x48, 0x44, 0x48, 0x01, 0x1f,
-    0x47, 0x01, 0xa7, 0x45, 0x45, 0xd5, 0x49, 0x45, 0x45, 0x48, 0x44, 0x48,
-    0xd8, 0x47, 0x47, 0x44, 0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3,
-    0x02, 0x33, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x8f, 0x40, 0x43, 0x01, 0x14,
-    0x14, 0x40, 0x15, 0x00, 0x09, 0x08, 0x04, 0x03, 0x11, 0x10, 0x02, 0x06,
-    0x05, 0x0d, 0x0c, 0x08, 0x03, 0x07, 0x02, 0x0b, 0x00, 0x0f, 0x0e, 0x02,
-    0x0a, 0x09, 0x13, 0x12, 0x02, 0x02, 0x01, 0x13, 0x0c, 0x01, 0x03, 0x00,
-    0x05, 0x04, 0x0e, 0x0d, 0x0b, 0x03, 0x0a, 0x05, 0x06, 0x12, 0x11, 0x03,
-    0x03, 0x02, 0x04, 0x04, 0x10, 0x0f, 0x04, 0x06, 0x07, 0x06, 0x01, 0x05,
-    0x04, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c,
-    0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17,
-    0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2e,
-    0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05,
-    0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
-    0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15, 0x23, 0x15,
-    0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x07, 0x35, 0x23, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x01, 0xf3, 0x44, 0x47, 0xfe, 0x99, 0x01, 0x63, 0x48,
-    0x47, 0x8f, 0x47, 0x8d, 0x90, 0xd0, 0x47, 0x48, 0x01, 0xf2, 0x44, 0x47,
-    0xd8, 0xd8, 0x44, 0xfe, 0x9d, 0x47, 0x00, 0x01, 0x00, 0x04, 0x00, 0x45,
-    0x01, 0xfc, 0x02, 0x3c, 0x00, 0x0b, 0x00, 0x67, 0x40, 0x2a, 0x01, 0x0c,
-    0x0c, 0x40, 0x0d, 0x00, 0x0b, 0x08, 0x07, 0x04, 0x03, 0x00, 0x0a, 0x09,
-    0x06, 0x03, 0x05, 0x02, 0x02, 0x01, 0x0b, 0x0a, 0x04, 0x00, 0x05, 0x04,
-    0x04, 0x02, 0x09, 0x08, 0x04, 0x07, 0x06, 0x03, 0x02, 0x01, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01,
-    0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00,
-    0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x0c, 0x49, 0x68,
-    0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff,
-    0xc0, 0x38, 0x59, 0x25, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x21, 0x01, 0xfc, 0xfe, 0x08, 0x01, 0xf8, 0xfe, 0x99, 0xd7,
-    0xd7, 0x01, 0x67, 0x45, 0x01, 0xf7, 0x46, 0x8f, 0x4a, 0x8f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x09, 0x00, 0x5c,
-    0x40, 0x24, 0x01, 0x0a, 0x0a, 0x40, 0x0b, 0x00, 0x09, 0x04, 0x03, 0x00,
-    0x06, 0x02, 0x01, 0x03, 0x05, 0x02, 0x08, 0x07, 0x01, 0x00, 0x04, 0x08,
-    0x05, 0x04, 0x04, 0x03, 0x02, 0x09, 0x08, 0x01, 0x07, 0x06, 0x00, 0x01,
-    0x07, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
-    0x07, 0x00, 0x0a, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
-    0x37, 0xb9, 0x00, 0x0a, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x23, 0x11, 0x21, 0x01, 0xf3, 0xfe, 0x9d, 0x01, 0x1c,
-    0xfe, 0xe6, 0x91, 0x01, 0xf2, 0x01, 0xee, 0x8d, 0x49, 0xd7, 0x01, 0xf2,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x17,
-    0x00, 0xa9, 0x40, 0x52, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00, 0x0a, 0x09,
-    0x16, 0x15, 0x03, 0x00, 0x12, 0x11, 0x02, 0x04, 0x03, 0x10, 0x0f, 0x02,
-    0x03, 0x01, 0x02, 0x06, 0x05, 0x0e, 0x0d, 0x02, 0x08, 0x07, 0x14, 0x13,
-    0x02, 0x17, 0x0c, 0x0b, 0x03, 0x00, 0x05, 0x04, 0x0e, 0x14, 0x03, 0x02,
-    0x0e, 0x14, 0x11, 0x10, 0x05, 0x00, 0x0f, 0x07, 0x06, 0x03, 0x0e, 0x05,
-    0x0a, 0x13, 0x12, 0x04, 0x00, 0x0d, 0x09, 0x08, 0x03, 0x0c, 0x04, 0x0a,
-    0x17, 0x16, 0x04, 0x15, 0x14, 0x0b, 0x0a, 0x01, 0x01, 0x00, 0x00, 0x01,
-    0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01,
-    0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2e, 0x2e, 0x00,
-    0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x18, 0x49, 0x68,
-    0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18, 0xff,
-    0xc0, 0x38, 0x59, 0x25, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35,
-    0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x35,
-    0x23, 0x35, 0x33, 0x01, 0xf3, 0xfe, 0x9d, 0x47, 0x48, 0x44, 0x48, 0x01,
-    0x66, 0xfe, 0xe6, 0x49, 0x46, 0x8f, 0x46, 0xd4, 0x41, 0x44, 0x48, 0xd8,
-    0x47, 0x47, 0x45, 0x47, 0xd5, 0x49, 0x8b, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x68, 0x40, 0x2c,
-    0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x02, 0x01, 0x02, 0x00, 0x04, 0x03,
-    0x02, 0x05, 0x08, 0x07, 0x02, 0x06, 0x05, 0x0a, 0x09, 0x02, 0x0b, 0x00,
-    0x03, 0x02, 0x04, 0x09, 0x08, 0x0b, 0x0a, 0x07, 0x03, 0x06, 0x01, 0x05,
-    0x04, 0x01, 0x03, 0x00, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18,
-    0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x01,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00,
-    0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
-    0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x35, 0x23, 0x15, 0x23,
-    0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x01, 0xf3, 0x8d, 0xd4, 0x91, 0x8d,
-    0xd5, 0x90, 0x41, 0xd5, 0xd5, 0x01, 0xf2, 0xd4, 0xd4, 0x00, 0x00, 0x01,
-    0x00, 0x33, 0x00, 0x41, 0x01, 0xde, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x72,
-    0x40, 0x32, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x0b, 0x08, 0x07, 0x03,
-    0x00, 0x08, 0x09, 0x06, 0x05, 0x02, 0x03, 0x01, 0x03, 0x09, 0x0a, 0x09,
-    0x02, 0x04, 0x03, 0x03, 0x02, 0x04, 0x00, 0x0b, 0x0a, 0x04, 0x00, 0x05,
-    0x04, 0x04, 0x06, 0x09, 0x08, 0x04, 0x06, 0x07, 0x06, 0x01, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
-    0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00,
-    0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
-    0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x21, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x01, 0xde, 0xfe, 0x55, 0x8d, 0x8d,
-    0x01, 0xab, 0x8d, 0x8d, 0x41, 0x46, 0x01, 0x63, 0x49, 0x45, 0xfe, 0x9c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b,
-    0x00, 0x65, 0x40, 0x29, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x04, 0x03,
-    0x02, 0x01, 0x08, 0x07, 0x02, 0x06, 0x05, 0x0a, 0x09, 0x02, 0x0b, 0x00,
-    0x09, 0x08, 0x01, 0x03, 0x00, 0x04, 0x02, 0x07, 0x06, 0x04, 0x05, 0x04,
-    0x0b, 0x0a, 0x01, 0x03, 0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37,
-    0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05,
-    0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
-    0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15, 0x21, 0x35,
-    0x23, 0x35, 0x33, 0x15, 0x33, 0x11, 0x33, 0x01, 0xf3, 0x44, 0xfe, 0x9a,
-    0x48, 0x8d, 0xd8, 0x8d, 0x89, 0x48, 0x44, 0x49, 0x45, 0x01, 0xaa, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x1d,
-    0x00, 0xca, 0x40, 0x68, 0x01, 0x1e, 0x1e, 0x40, 0x1f, 0x00, 0x18, 0x17,
-    0x02, 0x03, 0x01, 0x03, 0x00, 0x04, 0x03, 0x03, 0x1c, 0x1b, 0x06, 0x05,
-    0x02, 0x07, 0x0a, 0x09, 0x02, 0x08, 0x07, 0x0c, 0x0b, 0x02, 0x16, 0x15,
-    0x0e, 0x0d, 0x02, 0x14, 0x13, 0x1a, 0x19, 0x10, 0x03, 0x0f, 0x02, 0x1d,
-    0x12, 0x11, 0x03, 0x00, 0x03, 0x02, 0x0e, 0x04, 0x19, 0x18, 0x05, 0x00,
-    0x1b, 0x1a, 0x05, 0x00, 0x05, 0x04, 0x05, 0x0a, 0x15, 0x0d, 0x0c, 0x03,
-    0x14, 0x05, 0x08, 0x17, 0x16, 0x0b, 0x03, 0x0a, 0x05, 0x0e, 0x1d, 0x1c,
-    0x04, 0x00, 0x13, 0x0f, 0x0e, 0x03, 0x12, 0x04, 0x08, 0x11, 0x10, 0x09,
-    0x03, 0x08, 0x01, 0x07, 0x06, 0x01, 0x03, 0x00, 0x00, 0x01, 0x07, 0x46,
-    0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x10,
-    0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x07, 0x00, 0x1e, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x1e, 0xff, 0xc0, 0x38, 0x59,
-    0x25, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x33, 0x15, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x01, 0xf3, 0xd4, 0x47, 0x46, 0x91,
-    0x8d, 0x46, 0x47, 0x48, 0x90, 0x44, 0x47, 0x49, 0x45, 0x48, 0x47, 0x41,
-    0x44, 0x4a, 0x8e, 0x01, 0xf2, 0xd4, 0x46, 0x47, 0x47, 0x45, 0x47, 0x48,
-    0x46, 0x47, 0x48, 0x00, 0x00, 0x01, 0xff, 0xdd, 0x00, 0x41, 0x01, 0x88,
-    0x02, 0x33, 0x00, 0x05, 0x00, 0x4b, 0x40, 0x1a, 0x01, 0x06, 0x06, 0x40,
-    0x07, 0x00, 0x05, 0x00, 0x04, 0x03, 0x02, 0x02, 0x01, 0x05, 0x04, 0x04,
-    0x00, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x46, 0x76, 0x2f,
-    0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
-    0x00, 0x01, 0x00, 0x06, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
-    0x11, 0x37, 0xb9, 0x00, 0x06, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x21, 0x11,
-    0x33, 0x11, 0x21, 0x01, 0x88, 0xfe, 0x55, 0x8d, 0x01, 0x1e, 0x41, 0x01,
-    0xf2, 0xfe, 0x57, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3,
-    0x02, 0x33, 0x00, 0x13, 0x00, 0x95, 0x40, 0x47, 0x01, 0x14, 0x14, 0x40,
-    0x15, 0x00, 0x04, 0x03, 0x02, 0x05, 0x0e, 0x06, 0x05, 0x03, 0x0d, 0x03,
-    0x09, 0x10, 0x0f, 0x03, 0x00, 0x02, 0x01, 0x02, 0x00, 0x08, 0x07, 0x02,
-    0x09, 0x0c, 0x0b, 0x02, 0x0a, 0x09, 0x12, 0x11, 0x02, 0x13, 0x00, 0x11,
-    0x10, 0x05, 0x02, 0x05, 0x04, 0x05, 0x0f, 0x0e, 0x07, 0x06, 0x03, 0x03,
-    0x02, 0x05, 0x0d, 0x0c, 0x13, 0x12, 0x0b, 0x03, 0x0a, 0x01, 0x09, 0x08,
-    0x01, 0x03, 0x00, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
-    0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49,
-    0x68, 0xb9, 0x00, 0x09, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
-    0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x25,
-    0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x33, 0x15,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x33, 0x01, 0xf3, 0x8d, 0x46, 0x48,
-    0x46, 0x91, 0x8d, 0x48, 0x45, 0x48, 0x90, 0x41, 0xd5, 0x46, 0x46, 0xd5,
-    0x01, 0xf2, 0x44, 0x49, 0x46, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41,
-    0x01, 0xf3, 0x02, 0x33, 0x00, 0x13, 0x00, 0x90, 0x40, 0x44, 0x01, 0x14,
-    0x14, 0x40, 0x15, 0x00, 0x10, 0x0f, 0x04, 0x03, 0x03, 0x03, 0x00, 0x0e,
-    0x06, 0x05, 0x03, 0x0d, 0x03, 0x09, 0x02, 0x01, 0x02, 0x00, 0x08, 0x07,
-    0x02, 0x09, 0x0c, 0x0b, 0x02, 0x0a, 0x09, 0x12, 0x11, 0x02, 0x13, 0x00,
-    0x11, 0x10, 0x05, 0x03, 0x02, 0x05, 0x04, 0x05, 0x0f, 0x0e, 0x07, 0x06,
-    0x05, 0x0d, 0x0c, 0x13, 0x12, 0x0b, 0x03, 0x0a, 0x01, 0x09, 0x08, 0x01,
-    0x03, 0x00, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
-    0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
-    0x09, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
-    0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x35, 0x23,
-    0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x33,
-    0x15, 0x33, 0x35, 0x33, 0x01, 0xf3, 0x8d, 0x47, 0x47, 0x46, 0x91, 0x8d,
-    0x48, 0x47, 0x46, 0x90, 0x41, 0x44, 0x48, 0x49, 0xd5, 0x01, 0xf2, 0x44,
-    0x47, 0x49, 0xd4, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3,
-    0x02, 0x33, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x77, 0x40, 0x33, 0x01, 0x10,
-    0x10, 0x40, 0x11, 0x00, 0x0b, 0x0a, 0x05, 0x04, 0x0a, 0x09, 0x08, 0x07,
-    0x04, 0x03, 0x02, 0x01, 0x0f, 0x0e, 0x02, 0x06, 0x05, 0x0d, 0x0c, 0x02,
-    0x0b, 0x00, 0x0f, 0x0c, 0x01, 0x03, 0x00, 0x04, 0x02, 0x0e, 0x0d, 0x07,
-    0x03, 0x06, 0x04, 0x08, 0x09, 0x08, 0x01, 0x03, 0x02, 0x00, 0x01, 0x05,
-    0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05,
-    0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
-    0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15, 0x21, 0x35,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x03, 0x11, 0x23, 0x11, 0x01,
-    0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x44, 0x01, 0x67, 0x47, 0x8f, 0xd4, 0x89,
-    0x48, 0x44, 0x01, 0x67, 0x47, 0x44, 0xfe, 0x9a, 0x01, 0x63, 0xfe, 0x9d,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x70, 0x40, 0x30, 0x01, 0x0e, 0x0e, 0x40, 0x0f, 0x00,
-    0x08, 0x07, 0x02, 0x01, 0x0d, 0x04, 0x03, 0x03, 0x0c, 0x02, 0x06, 0x05,
-    0x0b, 0x0a, 0x02, 0x09, 0x00, 0x09, 0x08, 0x05, 0x00, 0x0d, 0x0a, 0x01,
-    0x03, 0x00, 0x04, 0x03, 0x02, 0x0c, 0x0b, 0x04, 0x06, 0x07, 0x06, 0x01,
-    0x05, 0x04, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
-    0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10,
-    0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
-    0x05, 0x00, 0x0e, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
-    0x37, 0xb9, 0x00, 0x0e, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x21,
-    0x15, 0x23, 0x11, 0x21, 0x15, 0x33, 0x07, 0x35, 0x23, 0x15, 0x01, 0xf3,
-    0x44, 0xfe, 0xe3, 0x91, 0x01, 0xab, 0x47, 0x8f, 0xd4, 0x01, 0x18, 0x48,
-    0x8f, 0x01, 0xf2, 0x44, 0xd7, 0xd4, 0xd4, 0x00, 0x00, 0x02, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x11, 0x00, 0x19, 0x00, 0xa6,
-    0x40, 0x52, 0x01, 0x1a, 0x1a, 0x40, 0x1b, 0x00, 0x0b, 0x0a, 0x07, 0x06,
-    0x0e, 0x0d, 0x08, 0x07, 0x03, 0x0a, 0x09, 0x19, 0x18, 0x03, 0x00, 0x15,
-    0x14, 0x02, 0x0c, 0x0b, 0x13, 0x12, 0x02, 0x11, 0x04, 0x03, 0x03, 0x00,
-    0x17, 0x16, 0x02, 0x10, 0x0f, 0x06, 0x05, 0x02, 0x05, 0x01, 0x11, 0x10,
-    0x05, 0x00, 0x16, 0x15, 0x03, 0x03, 0x02, 0x04, 0x04, 0x14, 0x13, 0x0d,
-    0x03, 0x0c, 0x04, 0x0e, 0x19, 0x12, 0x04, 0x18, 0x01, 0x00, 0x03, 0x17,
-    0x0f, 0x0e, 0x01, 0x09, 0x08, 0x05, 0x03, 0x04, 0x00, 0x01, 0x0b, 0x46,
-    0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x2f, 0x17,
-    0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10,
-    0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
-    0xb9, 0x00, 0x0b, 0x00, 0x1a, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
-    0x38, 0x11, 0x37, 0xb9, 0x00, 0x1a, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23,
-    0x15, 0x33, 0x15, 0x23, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x07, 0x35, 0x23, 0x11, 0x33, 0x35, 0x23, 0x35,
-    0x01, 0xf3, 0x45, 0x45, 0x45, 0x46, 0xfe, 0xe1, 0x48, 0x44, 0x01, 0x67,
-    0x47, 0x8f, 0xd4, 0x8d, 0x46, 0xd0, 0x46, 0x49, 0x46, 0x46, 0x44, 0x01,
-    0x67, 0x47, 0x44, 0xd7, 0xd4, 0xfe, 0x9d, 0x49, 0x46, 0x00, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x11, 0x00, 0x17,
-    0x00, 0xa8, 0x40, 0x54, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00, 0x17, 0x16,
-    0x08, 0x03, 0x07, 0x03, 0x00, 0x0a, 0x09, 0x03, 0x10, 0x0f, 0x04, 0x03,
-    0x03, 0x15, 0x0c, 0x0b, 0x03, 0x14, 0x02, 0x0e, 0x0d, 0x13, 0x02, 0x01,
-    0x03, 0x12, 0x02, 0x11, 0x06, 0x05, 0x03, 0x00, 0x17, 0x12, 0x05, 0x06,
-    0x11, 0x10, 0x05, 0x00, 0x03, 0x02, 0x05, 0x06, 0x09, 0x08, 0x05, 0x00,
-    0x05, 0x04, 0x04, 0x06, 0x16, 0x15, 0x01, 0x03, 0x00, 0x04, 0x0b, 0x0a,
-    0x14, 0x13, 0x04, 0x0e, 0x0f, 0x0e, 0x01, 0x0d, 0x0c, 0x07, 0x03, 0x06,
-    0x00, 0x01, 0x0d, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c,
-    0x3f, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17,
-    0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x00, 0x31,
-    0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0d, 0x00, 0x18, 0x49, 0x68, 0x61,
-    0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18, 0xff, 0xc0,
-    0x38, 0x59, 0x01, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x35, 0x23,
-    0x35, 0x23, 0x15, 0x23, 0x11, 0x21, 0x15, 0x33, 0x07, 0x35, 0x23, 0x15,
-    0x33, 0x35, 0x01, 0xf3, 0x8d, 0x46, 0x47, 0xd4, 0x47, 0x46, 0x91, 0x01,
-    0xab, 0x47, 0x8f, 0xd4, 0x90, 0x01, 0x18, 0x46, 0x48, 0x49, 0x44, 0x4a,
-    0x8e, 0x01, 0xf2, 0x44, 0x90, 0x8d, 0xd4, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x1b, 0x00, 0xb4, 0x40, 0x59,
-    0x01, 0x1c, 0x1c, 0x40, 0x1d, 0x00, 0x0c, 0x0b, 0x04, 0x03, 0x02, 0x01,
-    0x10, 0x0f, 0x03, 0x11, 0x12, 0x11, 0x0a, 0x03, 0x09, 0x02, 0x1b, 0x00,
-    0x18, 0x08, 0x07, 0x03, 0x17, 0x02, 0x0e, 0x0d, 0x06, 0x03, 0x05, 0x16,
-    0x15, 0x02, 0x1a, 0x19, 0x14, 0x03, 0x13, 0x1b, 0x1a, 0x05, 0x00, 0x0d,
-    0x0c, 0x05, 0x0e, 0x09, 0x08, 0x01, 0x03, 0x00, 0x04, 0x02, 0x07, 0x06,
-    0x04, 0x05, 0x04, 0x0b, 0x0a, 0x04, 0x19, 0x18, 0x15, 0x14, 0x04, 0x13,
-    0x12, 0x17, 0x16, 0x0f, 0x03, 0x0e, 0x04, 0x10, 0x11, 0x10, 0x01, 0x03,
-    0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c,
-    0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c,
-    0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x17,
-    0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
-    0xb9, 0x00, 0x05, 0x00, 0x1c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
-    0x38, 0x11, 0x37, 0xb9, 0x00, 0x1c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23,
-    0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x15, 0x33, 0x35, 0x21, 0x35, 0x23,
-    0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x35, 0x23, 0x15, 0x21,
-    0x15, 0x33, 0x01, 0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x8d, 0xd7, 0xfe, 0xe4,
-    0x48, 0x44, 0x01, 0x1f, 0x48, 0x8d, 0x8f, 0x01, 0x1c, 0x47, 0x89, 0x48,
-    0x44, 0x49, 0x45, 0x8b, 0x48, 0x90, 0x47, 0x44, 0x48, 0x45, 0x8b, 0x48,
-    0x00, 0x01, 0xff, 0xdd, 0x00, 0x41, 0x01, 0x88, 0x02, 0x33, 0x00, 0x07,
-    0x00, 0x5c, 0x40, 0x24, 0x01, 0x08, 0x08, 0x40, 0x09, 0x00, 0x07, 0x00,
-    0x08, 0x01, 0x06, 0x05, 0x03, 0x01, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01,
-    0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x06, 0x07, 0x06, 0x01, 0x03, 0x02,
-    0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
-    0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
-    0xb9, 0x00, 0x05, 0x00, 0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
-    0x38, 0x11, 0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x23,
-    0x11, 0x23, 0x11, 0x23, 0x35, 0x21, 0x01, 0x88, 0x8c, 0x90, 0x8f, 0x01,
-    0xab, 0x01, 0xee, 0xfe, 0x53, 0x01, 0xa9, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x0b, 0x00, 0x64, 0x40, 0x29,
-    0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x05, 0x04, 0x04, 0x03, 0x02, 0x01,
-    0x08, 0x07, 0x02, 0x06, 0x05, 0x0a, 0x09, 0x02, 0x0b, 0x00, 0x09, 0x08,
-    0x01, 0x03, 0x00, 0x04, 0x02, 0x0b, 0x0a, 0x07, 0x03, 0x06, 0x01, 0x03,
-    0x02, 0x00, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c,
-    0x3f, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c,
-    0x2f, 0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31,
-    0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x0c, 0x49, 0x68, 0x61,
-    0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0,
-    0x38, 0x59, 0x25, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x01, 0xf3, 0x44, 0xfe, 0x9a, 0x48, 0x8d, 0xd5, 0x90, 0x89,
-    0x48, 0x44, 0x01, 0xae, 0xfe, 0x56, 0x01, 0xaa, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x17, 0x00, 0xab, 0x40, 0x53,
-    0x01, 0x18, 0x18, 0x40, 0x19, 0x00, 0x0b, 0x0a, 0x03, 0x02, 0x02, 0x01,
-    0x08, 0x05, 0x0c, 0x0b, 0x08, 0x07, 0x04, 0x03, 0x08, 0x05, 0x06, 0x05,
-    0x02, 0x07, 0x12, 0x08, 0x07, 0x03, 0x11, 0x03, 0x0d, 0x14, 0x13, 0x03,
-    0x00, 0x10, 0x0a, 0x09, 0x03, 0x0f, 0x02, 0x0e, 0x0d, 0x16, 0x15, 0x02,
-    0x17, 0x00, 0x0d, 0x0c, 0x05, 0x0e, 0x15, 0x14, 0x05, 0x05, 0x04, 0x13,
-    0x01, 0x00, 0x03, 0x12, 0x05, 0x06, 0x11, 0x10, 0x05, 0x09, 0x08, 0x17,
-    0x16, 0x0f, 0x03, 0x0e, 0x01, 0x07, 0x06, 0x00, 0x01, 0x0d, 0x46, 0x76,
-    0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c,
-    0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30,
-    0x01, 0x49, 0x68, 0xb9, 0x00, 0x0d, 0x00, 0x18, 0x49, 0x68, 0x61, 0xb0,
-    0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18, 0xff, 0xc0, 0x38,
-    0x59, 0x01, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35,
-    0x23, 0x35, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35,
-    0x33, 0x01, 0xf3, 0x44, 0x47, 0x48, 0x48, 0x48, 0x47, 0x48, 0x8d, 0x48,
-    0x45, 0x48, 0x90, 0x01, 0x18, 0x48, 0x47, 0x48, 0x44, 0x48, 0x47, 0x01,
-    0x1f, 0xd2, 0x4a, 0x46, 0xd6, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41,
-    0x01, 0xf3, 0x02, 0x33, 0x00, 0x13, 0x00, 0x95, 0x40, 0x47, 0x01, 0x14,
-    0x14, 0x40, 0x15, 0x00, 0x0e, 0x0d, 0x02, 0x0f, 0x10, 0x0f, 0x04, 0x03,
-    0x03, 0x03, 0x00, 0x06, 0x05, 0x03, 0x09, 0x02, 0x01, 0x02, 0x00, 0x08,
-    0x07, 0x02, 0x09, 0x0c, 0x0b, 0x02, 0x0a, 0x09, 0x12, 0x11, 0x02, 0x13,
-    0x00, 0x03, 0x02, 0x05, 0x0c, 0x0f, 0x0e, 0x05, 0x05, 0x04, 0x11, 0x10,
-    0x0d, 0x03, 0x0c, 0x05, 0x07, 0x06, 0x13, 0x12, 0x0b, 0x03, 0x0a, 0x01,
-    0x09, 0x08, 0x01, 0x03, 0x00, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37,
-    0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10,
-    0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x31, 0x30,
-    0x01, 0x49, 0x68, 0xb9, 0x00, 0x09, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0,
-    0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38,
-    0x59, 0x25, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x23, 0x11,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x01, 0xf3, 0x8d,
-    0x47, 0x46, 0x47, 0x91, 0x8d, 0x46, 0x49, 0x46, 0x90, 0x41, 0x44, 0x4a,
-    0x46, 0x48, 0x01, 0xf2, 0xd4, 0x45, 0x45, 0xd4, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x23, 0x00, 0xe5, 0x40, 0x75,
-    0x01, 0x24, 0x24, 0x40, 0x25, 0x00, 0x21, 0x20, 0x19, 0x18, 0x15, 0x14,
-    0x07, 0x06, 0x03, 0x02, 0x22, 0x21, 0x1e, 0x1d, 0x10, 0x0f, 0x0c, 0x0b,
-    0x04, 0x03, 0x06, 0x05, 0x03, 0x09, 0x16, 0x15, 0x03, 0x09, 0x18, 0x17,
-    0x03, 0x00, 0x20, 0x1f, 0x02, 0x03, 0x01, 0x02, 0x00, 0x08, 0x07, 0x02,
-    0x09, 0x14, 0x13, 0x0e, 0x03, 0x0d, 0x02, 0x12, 0x11, 0x0a, 0x03, 0x09,
-    0x1a, 0x19, 0x02, 0x23, 0x1c, 0x1b, 0x03, 0x00, 0x0d, 0x0c, 0x05, 0x00,
-    0x0f, 0x0e, 0x05, 0x12, 0x1f, 0x1e, 0x05, 0x12, 0x23, 0x22, 0x05, 0x00,
-    0x0b, 0x05, 0x04, 0x03, 0x0a, 0x05, 0x00, 0x11, 0x10, 0x05, 0x12, 0x1d,
-    0x17, 0x16, 0x03, 0x1c, 0x05, 0x12, 0x1b, 0x1a, 0x13, 0x03, 0x12, 0x01,
-    0x09, 0x08, 0x01, 0x03, 0x00, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37,
-    0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
-    0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd,
-    0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49,
-    0x68, 0xb9, 0x00, 0x09, 0x00, 0x24, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
-    0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x24, 0xff, 0xc0, 0x38, 0x59, 0x25,
-    0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x33, 0x35,
-    0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x35,
-    0x33, 0x35, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x01,
-    0xf3, 0x8d, 0x47, 0x46, 0x47, 0x91, 0x44, 0x49, 0x45, 0x48, 0x8d, 0x48,
-    0x45, 0x48, 0x90, 0x44, 0x49, 0x46, 0x47, 0x41, 0x44, 0x4a, 0x46, 0x48,
-    0x8d, 0x48, 0x46, 0x47, 0x90, 0x44, 0x49, 0x46, 0x47, 0x8c, 0x48, 0x46,
-    0x47, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x41, 0x01, 0xcf, 0x02, 0x33,
-    0x00, 0x0f, 0x00, 0x81, 0x40, 0x3b, 0x01, 0x10, 0x10, 0x40, 0x11, 0x00,
-    0x08, 0x07, 0x03, 0x02, 0x01, 0x04, 0x03, 0x02, 0x05, 0x0c, 0x06, 0x05,
-    0x03, 0x0b, 0x02, 0x0a, 0x09, 0x0e, 0x0d, 0x02, 0x0f, 0x00, 0x03, 0x02,
-    0x05, 0x0a, 0x07, 0x06, 0x05, 0x0a, 0x0d, 0x0c, 0x01, 0x03, 0x00, 0x05,
-    0x0a, 0x09, 0x08, 0x05, 0x0a, 0x0f, 0x0e, 0x0b, 0x03, 0x0a, 0x01, 0x05,
-    0x04, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c,
-    0x3f, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
-    0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd,
-    0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x00, 0x31, 0x30,
-    0x01, 0x49, 0x68, 0xb9, 0x00, 0x09, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0,
-    0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38,
-    0x59, 0x01, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x01, 0xcf, 0x44, 0x47, 0x91, 0x47, 0x48,
-    0x8d, 0x8e, 0x90, 0x01, 0x5f, 0x47, 0xd7, 0xd3, 0x48, 0xd7, 0xd4, 0xd4,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x01, 0xf3, 0x02, 0x33, 0x00, 0x17,
-    0x00, 0xa6, 0x40, 0x52, 0x01, 0x18, 0x18, 0x40, 0x19, 0x00, 0x08, 0x07,
-    0x03, 0x16, 0x15, 0x0c, 0x03, 0x0b, 0x06, 0x05, 0x03, 0x0e, 0x0d, 0x10,
-    0x0f, 0x03, 0x04, 0x03, 0x12, 0x11, 0x03, 0x02, 0x01, 0x14, 0x13, 0x03,
-    0x17, 0x0a, 0x09, 0x03, 0x00, 0x11, 0x10, 0x03, 0x03, 0x02, 0x05, 0x16,
-    0x0f, 0x05, 0x04, 0x03, 0x0e, 0x05, 0x0a, 0x13, 0x12, 0x01, 0x03, 0x00,
-    0x05, 0x16, 0x0d, 0x07, 0x06, 0x03, 0x0c, 0x05, 0x0a, 0x09, 0x08, 0x04,
-    0x0a, 0x15, 0x14, 0x04, 0x16, 0x17, 0x16, 0x01, 0x0b, 0x0a, 0x00, 0x01,
-    0x0b, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x10,
-    0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17,
-    0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x17,
-    0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f,
-    0x3c, 0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01,
-    0x49, 0x68, 0xb9, 0x00, 0x0b, 0x00, 0x18, 0x49, 0x68, 0x61, 0xb0, 0x40,
-    0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x18, 0xff, 0xc0, 0x38, 0x59,
-    0x01, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21,
-    0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21,
-    0x01, 0xf3, 0x44, 0x47, 0x48, 0x49, 0x01, 0x1c, 0xfe, 0x0e, 0x44, 0x48,
-    0x47, 0x49, 0xfe, 0xe4, 0x01, 0xf2, 0x01, 0xa7, 0x48, 0x47, 0x48, 0x46,
-    0x49, 0x8d, 0x48, 0x47, 0x48, 0x45, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c,
-    0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x02, 0x3c,
-    0x00, 0x00, 0x02, 0xd8, 0x00, 0x00, 0x03, 0xde, 0x00, 0x00, 0x04, 0xe8,
-    0x00, 0x00, 0x05, 0xc2, 0x00, 0x00, 0x06, 0x8c, 0x00, 0x00, 0x07, 0x76,
-    0x00, 0x00, 0x08, 0x3c, 0x00, 0x00, 0x09, 0x62, 0x00, 0x00, 0x0a, 0x4c,
-    0x00, 0x00, 0x0b, 0x2e, 0x00, 0x00, 0x0b, 0xfe, 0x00, 0x00, 0x0c, 0xfe,
-    0x00, 0x00, 0x0d, 0xcc, 0x00, 0x00, 0x0e, 0x60, 0x00, 0x00, 0x0e, 0xe6,
-    0x00, 0x00, 0x0f, 0xd2, 0x00, 0x00, 0x10, 0x64, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x00, 0x11, 0x92, 0x00, 0x00, 0x12, 0xaa, 0x00, 0x00, 0x13, 0x16,
-    0x00, 0x00, 0x13, 0xe4, 0x00, 0x00, 0x14, 0xae, 0x00, 0x00, 0x15, 0x5e,
-    0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x16, 0xf4, 0x00, 0x00, 0x17, 0xe2,
-    0x00, 0x00, 0x18, 0xe2, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x19, 0xf2,
-    0x00, 0x00, 0x1a, 0xe0, 0x00, 0x00, 0x1b, 0xae, 0x00, 0x00, 0x1c, 0xec,
-    0x00, 0x00, 0x1d, 0x9e, 0x00, 0x00, 0x1e, 0x8a, 0x00, 0x00, 0x1f, 0x6c,
-    0x00, 0x00, 0x20, 0x3c, 0x00, 0x00, 0x21, 0x3c, 0x00, 0x00, 0x22, 0x0a,
-    0x00, 0x00, 0x22, 0x9e, 0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x24, 0x10,
-    0x00, 0x00, 0x24, 0xa2, 0x00, 0x00, 0x25, 0x40, 0x00, 0x00, 0x25, 0xd0,
-    0x00, 0x00, 0x26, 0xe8, 0x00, 0x00, 0x27, 0x54, 0x00, 0x00, 0x28, 0x22,
-    0x00, 0x00, 0x28, 0xec, 0x00, 0x00, 0x29, 0x9c, 0x00, 0x00, 0x2a, 0x40,
-    0x00, 0x00, 0x2b, 0x32, 0x00, 0x00, 0x2c, 0x20, 0x00, 0x00, 0x2d, 0x20,
-    0x00, 0x00, 0x2d, 0xa0, 0x00, 0x00, 0x2e, 0x30, 0x00, 0x00, 0x2f, 0x1e,
-    0x00, 0x00, 0x2f, 0xec, 0x00, 0x00, 0x31, 0x2a, 0x00, 0x00, 0x31, 0xdc,
-    0x00, 0x00, 0x32, 0xc8, 0x00, 0x00, 0x32, 0xc8, 0x00, 0x00, 0x32, 0xc8,
-    0x00, 0x00, 0x32, 0xc8, 0x00, 0x00, 0x32, 0xc8, 0x00, 0x00, 0x32, 0xc8,
-    0x00, 0x00, 0x32, 0xc8, 0x00, 0x00, 0x32, 0xc8, 0x00, 0x00, 0x32, 0xc8,
-    0x00, 0x00, 0x32, 0xc8, 0x01, 0xf4, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0xbc, 0x00, 0x17,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x41, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x04,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x33, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0xff, 0xdd, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0xff, 0xdd,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x24, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x04, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x33,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0xff, 0xdd,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0xff, 0xdd, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01, 0x02, 0x26, 0x00, 0x01,
-    0x02, 0x26, 0x00, 0x24, 0x02, 0x26, 0x00, 0x01, 0x03, 0xe8, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
-    0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x7b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x03, 0x00, 0x04, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c,
-    0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29,
-    0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f,
-    0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35,
-    0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b,
-    0x00, 0x3c, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47,
-    0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d,
-    0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53,
-    0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59,
-    0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x01, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0x07,
-    0x01, 0x08, 0x09, 0x61, 0x66, 0x69, 0x69, 0x31, 0x30, 0x30, 0x39, 0x38,
-    0x07, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x36, 0x38, 0x07, 0x67, 0x6c, 0x79,
-    0x70, 0x68, 0x36, 0x39, 0x07, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x36, 0x37,
-    0x05, 0x63, 0x68, 0x32, 0x35, 0x35, 0x05, 0x63, 0x68, 0x32, 0x35, 0x34,
-    0x05, 0x63, 0x68, 0x32, 0x35, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x30,
-    0x00, 0x06, 0x02, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b,
-    0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x10,
-    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c,
-    0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
-    0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
-    0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-    0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a,
-    0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40,
-    0x00, 0x41, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
-    0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49,
-    0x00, 0x4a, 0x00, 0x4b, 0x00, 0x04, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x0c,
-    0x00, 0x08, 0x00, 0x02, 0x00, 0x04, 0x00, 0x21, 0x00, 0x39, 0x00, 0x5a,
-    0x00, 0x7a, 0x04, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30,
-    0x00, 0x41, 0x00, 0x61, 0x04, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x0e,
-    0x00, 0x20, 0x00, 0x52, 0x00, 0x84, 0xff, 0xff, 0x00, 0x03, 0x00, 0x04,
-    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
-    0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10,
-    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c,
-    0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
-    0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
-    0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-    0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a,
-    0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40,
-    0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x50, 0x09, 0x09, 0x05, 0x00, 0x01, 0x01, 0x06, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x09, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00,
-    0x0a, 0x0a, 0x05, 0x00, 0x01, 0x01, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0a, 0x01, 0x01,
-    0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x0b, 0x0b, 0x06, 0x00,
-    0x01, 0x01, 0x08, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x06, 0x06,
-    0x06, 0x06, 0x00, 0x00, 0x0c, 0x0c, 0x06, 0x00, 0x02, 0x02, 0x08, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x0c, 0x02, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00,
-    0x0d, 0x0d, 0x07, 0x00, 0x02, 0x02, 0x09, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0d, 0x02, 0x02,
-    0x02, 0x02, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x0e, 0x0e, 0x07, 0x00,
-    0x02, 0x02, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x07, 0x07,
-    0x07, 0x07, 0x00, 0x00, 0x0f, 0x0f, 0x08, 0x00, 0x02, 0x02, 0x0b, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x0f, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
-    0x10, 0x10, 0x08, 0x00, 0x02, 0x02, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x10, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x11, 0x11, 0x09, 0x00,
-    0x02, 0x02, 0x0c, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x11, 0x02, 0x02, 0x02, 0x02, 0x09, 0x09,
-    0x09, 0x09, 0x00, 0x00, 0x12, 0x12, 0x09, 0x00, 0x02, 0x02, 0x0d, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x12, 0x02, 0x02, 0x02, 0x02, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00,
-    0x13, 0x13, 0x0a, 0x00, 0x02, 0x02, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x13, 0x02, 0x02,
-    0x02, 0x02, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x14, 0x14, 0x0a, 0x00,
-    0x03, 0x03, 0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x14, 0x03, 0x03, 0x03, 0x03, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x00, 0x00, 0x15, 0x15, 0x0b, 0x00, 0x03, 0x03, 0x0f, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x15, 0x03, 0x03, 0x03, 0x03, 0x0b, 0x0b, 0x0b, 0x0b, 0x00, 0x00,
-    0x16, 0x16, 0x0b, 0x00, 0x03, 0x03, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x16, 0x03, 0x03,
-    0x03, 0x03, 0x0b, 0x0b, 0x0b, 0x0b, 0x00, 0x00, 0x17, 0x17, 0x0c, 0x00,
-    0x03, 0x03, 0x10, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x17, 0x03, 0x03, 0x03, 0x03, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x00, 0x00, 0x18, 0x18, 0x0c, 0x00, 0x03, 0x03, 0x11, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x18, 0x03, 0x03, 0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
-    0x00, 0x01, 0x04, 0x3b, 0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x02, 0xbc,
-    0x02, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0x02, 0xbc, 0x02, 0x8a, 0x00, 0x00,
-    0x01, 0xc5, 0x00, 0x32, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x41,
-    0x43, 0x52, 0x00, 0x40, 0x00, 0x20, 0x00, 0x5a, 0x03, 0x2c, 0xff, 0x48,
-    0x00, 0x00, 0x03, 0x2c, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x03, 0x2c, 0x00, 0x00, 0x60, 0x00, 0x02, 0x33, 0x02, 0x75,
-    0x41, 0x72, 0x63, 0x61, 0x64, 0x65, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69,
-    0x20, 0x20, 0x20, 0x20, 0xff, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xfe,
-    0x41, 0x52, 0x43, 0x52, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x59, 0x55, 0xcd, 0xfb,
-    0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00,
-    0xba, 0x6b, 0x1c, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xba, 0x6b, 0x1c, 0xa8,
-    0xff, 0xdd, 0x00, 0x00, 0x01, 0xfc, 0x03, 0x2c, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x03, 0x2c, 0xff, 0x38, 0x00, 0x00, 0x03, 0xe8, 0xff, 0xdd, 0x00, 0x2a,
-    0x01, 0xfc, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x4c, 0x00, 0x24, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x08, 0x00, 0x40, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x79, 0x00, 0xe5,
-    0x00, 0x01, 0x00, 0x01};
-
-constexpr unsigned int ARCADECLASSIC_TTF_len = 17296;
-
-#endif
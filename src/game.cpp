@@ -0,0 +1,479 @@
+#include "game.h"
+#include "alloc.h"
+#include "clock.h"
+#include "constants.h"
+#include "grid.h"
+#include "hud.h"
+#include "keys.h"
+#include "latency.h"
+#include "loader.h"
+#include "menu.h"
+#include "overlay.h"
+#include "particles.h"
+#include "profile.h"
+#include "recorder.h"
+#include "render.h"
+#include "replay.h"
+#include "scheduler.h"
+#include "sfx.h"
+#include "snapshot.h"
+#include "spectator.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <iterator>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace Game {
+
+// At worst, the progress lost to a crash
+constexpr std::uint64_t AUTOSAVE_STEPS = 10 * 60;
+
+void startRecording(T &t) {
+  if (t.options.record.empty() || t.isReplaying) {
+    return;
+  }
+  std::string path = t.options.record;
+  if (t.recordedGames > 0) {
+    path += "." + std::to_string(t.recordedGames);
+  }
+
+  Recorder::Header header;
+  header.seed = t.state.seed;
+  header.das = t.state.handling.das.asMicroseconds();
+  header.arr = t.state.handling.arr.asMicroseconds();
+  header.softDropFactor = t.state.handling.softDropFactor;
+
+  if (Recorder::start(t.recorder, path, header)) {
+    t.recordedGames += 1;
+  } else {
+    std::cerr << "Cannot record to " << path << std::endl;
+  }
+}
+
+void recordSpeed(T &t) {
+  Recorder::Record record;
+  record.tick = t.state.tick;
+  record.kind = Recorder::SPEED;
+  record.speed = t.state.speed;
+  Recorder::push(t.recorder, record);
+}
+
+// The input about to be consumed by the coming step
+void recordInput(T &t) {
+  sf::Time end = t.state.time + fixedStep;
+  std::size_t count = Keys::countBefore(t.keys, end);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const Keys::Event &input = Keys::peek(t.keys, i);
+    Recorder::Record record;
+    record.tick = t.state.tick;
+    record.kind = input.pressed ? Recorder::PRESS : Recorder::RELEASE;
+    record.key = std::uint8_t(input.key);
+    record.offset = std::uint32_t(
+        std::max<sf::Int64>(0, (input.time - t.state.time).asMicroseconds()));
+    Recorder::push(t.recorder, record);
+  }
+}
+
+// Finishes the recording, a replay is over
+void endGame(T &t) {
+  Recorder::stop(t.recorder, t.state.tick);
+  if (t.isReplaying) {
+    Replay::close(t.replay);
+    t.isReplaying = false;
+  }
+}
+
+void handleChoice(T &t, Menu::Action action, float speed) {
+  switch (action) {
+  case Menu::RESTART_CONFIRMED:
+    endGame(t);
+    t.state = State::init();
+    t.state.handling = t.options.handling;
+    Keys::reset(t.keys);
+    [[fallthrough]];
+  case Menu::PLAY:
+  case Menu::RESUME:
+    t.state.name = State::Name::PLAYING;
+    t.accumulatedTime = sf::Time::Zero;
+    Clock::restart(t.clock);
+    if (t.isReplaying) {
+      break;
+    }
+    if (t.state.tick == 0 && !Recorder::isRecording(t.recorder)) {
+      startRecording(t);
+    }
+    t.state.speed = speed;
+    recordSpeed(t);
+    break;
+  case Menu::QUIT:
+    t.window->close();
+    break;
+  default:
+    std::cerr << "Received invalid choice: " << action << std::endl;
+    throw std::invalid_argument("invalid choice");
+  }
+}
+
+// Goes on with the game that was quit, or that crashed, from the pause menu
+void resume(T &t) {
+  State::T saved;
+  if (!Snapshot::load(t.options.save, saved)) {
+    return;
+  }
+  t.state = saved;
+  t.state.handling = t.options.handling;
+  // No key is held anymore
+  t.state.shiftDirection = 0;
+  t.state.name = State::Name::PAUSED;
+  Menu::open(t.menu, Menu::PAUSE);
+  // Resuming sets the speed chosen in the menu
+  for (std::size_t i = 0; i < std::size(Menu::SPEEDS); ++i) {
+    if (Menu::SPEEDS[i].value == saved.speed) {
+      t.menu.settings[Menu::SPEED] = i;
+    }
+  }
+}
+
+void init(T &t, sf::RenderWindow &window, Options options) {
+  t.window = &window;
+  t.options = options;
+  t.scheduler = Scheduler::init(options.policy);
+  Scheduler::apply(t.scheduler, window);
+  t.target = Render::init(window);
+  t.clock = Clock::init(options.clock);
+  t.grid = Grid::init(GRID_ORIGIN);
+  t.particles = Particles::init();
+  Loader::start(t.loader);
+  t.startup.window = Latency::now();
+  t.state = State::init();
+  t.state.handling = options.handling;
+  t.menu = Menu::init([&t](Menu::Action action, float speed) {
+    handleChoice(t, action, speed);
+  });
+
+  if (!options.replay.empty()) {
+    if (Replay::open(t.replay, options.replay)) {
+      t.isReplaying = true;
+      t.state = Replay::init(t.replay);
+    } else {
+      std::cerr << "Cannot open replay " << options.replay << std::endl;
+    }
+  }
+
+  // A recording or a replay starts from a new game
+  if (!options.save.empty() &&
+      (!options.record.empty() || !options.replay.empty())) {
+    std::cerr << "Not saving while recording or replaying" << std::endl;
+  } else if (!options.save.empty()) {
+    resume(t);
+    Snapshot::start(t.autosave, options.save);
+  }
+
+  if (!options.spectate.empty() &&
+      !Spectator::start(t.spectator, options.spectate)) {
+    std::cerr << "Cannot stream to " << options.spectate << std::endl;
+  }
+}
+
+// Everything drawn with the font appears once it is loaded
+void finishLoading(T &t) {
+  Loader::wait(t.loader);
+  Overlay::init(t.overlay, t.loader.font);
+  Hud::init(t.hud, t.loader.font, HUD_ORIGIN);
+  t.menu.font = &t.loader.font;
+  if (t.options.sound) {
+    t.loader.music.play();
+    Sfx::start(t.sfx, t.loader.effects);
+  }
+  t.isLoaded = true;
+  t.startup.assets = Latency::now();
+}
+
+void stop(T &t) {
+  Alloc::trackSites(false);
+  Loader::wait(t.loader);
+  Sfx::stop(t.sfx);
+  if (t.state.tick > 0) {
+    Snapshot::request(t.autosave, t.state);
+  }
+  Snapshot::stop(t.autosave);
+  endGame(t);
+  Spectator::stop(t.spectator);
+}
+
+int turboFactor(const T &t) { return turboFactors[t.turbo]; }
+
+sf::Time simulationTime(const T &t) {
+  if (t.state.name != State::Name::PLAYING) {
+    return t.state.time;
+  }
+  return t.state.time + t.accumulatedTime +
+         Clock::elapsed(t.clock) * sf::Int64(turboFactor(t));
+}
+
+void consumeEvents(T &t) {
+  Particles::trigger(t.particles, t.state.events);
+  Sfx::trigger(t.sfx, t.state.events);
+  t.state.events = State::Events{};
+}
+
+void pause(T &t) {
+  t.state.name = State::Name::PAUSED;
+  Menu::open(t.menu, Menu::PAUSE);
+  Snapshot::request(t.autosave, t.state);
+  if (t.isReplaying) {
+    // The replay holds and releases keys on its own
+    return;
+  }
+  Keys::clear(t.keys);
+  // Keys released during the pause must reach the simulation, and the
+  // recording, through events
+  Keys::releaseAll(t.keys, t.state.time);
+}
+
+void handleMenuKey(T &t, sf::Keyboard::Key key) {
+  if (key == sf::Keyboard::Escape) {
+    Menu::cancel(t.menu);
+  } else if (key == sf::Keyboard::Down) {
+    Menu::selectDown(t.menu);
+  } else if (key == sf::Keyboard::Up) {
+    Menu::selectUp(t.menu);
+  } else if (key == sf::Keyboard::Left) {
+    Menu::selectLeft(t.menu);
+  } else if (key == sf::Keyboard::Right) {
+    Menu::selectRight(t.menu);
+  } else if (key == sf::Keyboard::Enter) {
+    Menu::choose(t.menu);
+  }
+}
+
+void handleEvent(T &t, const sf::Event &event, sf::Time timestamp) {
+  if (event.type == sf::Event::Closed) {
+    t.window->close();
+  }
+
+  // Nothing to show for them yet
+  if (!t.isLoaded) {
+    return;
+  }
+
+  bool isPlaying = t.state.name == State::Name::PLAYING;
+
+  if (event.type == sf::Event::KeyPressed) {
+    auto key = event.key.code;
+    if (Keys::isHeld(t.keys, key)) {
+      return;
+    }
+    if (key == sf::Keyboard::F3) {
+      Overlay::toggle(t.overlay);
+      Keys::press(t.keys, key);
+    } else if (key == sf::Keyboard::F4) {
+      t.turbo = (t.turbo + 1) % std::size(turboFactors);
+      t.accumulatedTime = sf::Time::Zero;
+      Keys::press(t.keys, key);
+#ifdef TETRIS_PROFILE
+    } else if (key == sf::Keyboard::F5) {
+      // The last frames, including the one that looked wrong
+      std::string path = "trace-" + std::to_string(t.traces++) + ".json";
+      if (Profile::save(path)) {
+        std::cout << "trace written to " << path << std::endl;
+      }
+      Keys::press(t.keys, key);
+#endif
+    } else if (isPlaying && key == sf::Keyboard::Escape) {
+      pause(t);
+      Keys::press(t.keys, key);
+    } else if (isPlaying && t.isReplaying) {
+      Keys::press(t.keys, key);
+    } else if (isPlaying) {
+      // Consumed by the simulation at the next step boundary
+      Keys::push(t.keys, {key, true, simulationTime(t), timestamp});
+    } else {
+      handleMenuKey(t, key);
+      Keys::press(t.keys, key);
+    }
+  }
+
+  if (event.type == sf::Event::KeyReleased) {
+    auto key = event.key.code;
+    if (isPlaying && !t.isReplaying) {
+      Keys::push(t.keys, {key, false, simulationTime(t), timestamp});
+    } else {
+      Keys::release(t.keys, key);
+    }
+  }
+}
+
+void step(T &t) {
+  PROFILE_ZONE("Game::step");
+  Alloc::Counters before = Alloc::local();
+  if (t.isReplaying) {
+    t.state = Replay::feed(t.replay, t.state, t.keys);
+    if (t.replay.isOver) {
+      // Let the player take over from there
+      endGame(t);
+      t.state.name = State::Name::SHOWING_FIRST_MENU;
+      Menu::open(t.menu, Menu::MAIN);
+      return;
+    }
+  }
+  if (Recorder::isRecording(t.recorder)) {
+    recordInput(t);
+  }
+
+  t.state = State::step(t.state, t.keys);
+  Spectator::push(t.spectator, t.state);
+  if (t.state.tick % AUTOSAVE_STEPS == 0) {
+    Snapshot::request(t.autosave, t.state);
+  }
+  consumeEvents(t);
+  Particles::update(t.particles, fixedStep.asSeconds());
+  t.stepAllocations = t.stepAllocations + (Alloc::local() - before);
+
+  if (t.state.name == State::Name::LOST) {
+    // Removes the save, there is nothing to resume
+    Snapshot::request(t.autosave, t.state);
+    endGame(t);
+    Menu::open(t.menu, Menu::GAME_OVER);
+  }
+}
+
+// Steps until the frame budget runs out, however much time it simulates
+void fastForward(T &t) {
+  sf::Clock budget;
+  while (t.state.name == State::Name::PLAYING &&
+         budget.getElapsedTime().asSeconds() < turboFrameBudget) {
+    step(t);
+    t.stepsLastFrame += 1;
+  }
+}
+
+void handleScript(T &t) {
+  sf::Time now = Latency::now();
+  while (t.scriptPosition < t.script.size() &&
+         t.script[t.scriptPosition].at <= now) {
+    const Scripted &scripted = t.script[t.scriptPosition++];
+    handleEvent(t, scripted.event, scripted.at);
+  }
+}
+
+void frame(T &t) {
+  PROFILE_ZONE("Game::frame");
+  Alloc::Counters before = Alloc::local();
+  bool wasPlaying = t.state.name == State::Name::PLAYING;
+  // Only the allocations of the game itself are worth attributing
+  Alloc::trackSites(wasPlaying);
+  t.stepAllocations = Alloc::Counters{};
+  sf::Event event;
+
+  // Nothing moves on its own outside of the game, sleep until the next input
+  bool shouldWait = t.state.name != State::Name::PLAYING &&
+                    t.script.empty() && t.isLoaded;
+
+  while (Scheduler::nextEvent(*t.window, event, shouldWait)) {
+    handleEvent(t, event, Latency::now());
+  }
+  handleScript(t);
+
+  if (!t.isLoaded && Loader::isReady(t.loader)) {
+    finishLoading(t);
+  }
+
+  t.window->clear(COLOR_BACKGROUND);
+
+  t.stepsLastFrame = 0;
+
+  if (t.state.name == State::Name::PLAYING) {
+    sf::Time elapsed = Clock::restart(t.clock);
+    if (elapsed > sf::seconds(maxFrameGap)) {
+      // Window dragged, debugger, suspend: let the player resume instead
+      t.droppedTime += elapsed;
+      pause(t);
+    } else if (turboFactor(t) == 0) {
+      fastForward(t);
+    } else {
+      t.accumulatedTime += elapsed * sf::Int64(turboFactor(t));
+    }
+
+    while (t.accumulatedTime >= fixedStep &&
+           t.stepsLastFrame < maxStepsPerFrame * turboFactor(t)) {
+      step(t);
+      if (t.state.name != State::Name::PLAYING) {
+        break;
+      }
+
+      t.accumulatedTime -= fixedStep;
+      t.stepsLastFrame += 1;
+    }
+
+    // Too slow to keep up: drop whole steps, keep the fraction
+    if (t.accumulatedTime >= fixedStep) {
+      sf::Time late = t.accumulatedTime - t.accumulatedTime % fixedStep;
+      t.droppedTime += late;
+      t.accumulatedTime -= late;
+    }
+  }
+
+  Grid::draw(t.grid, t.target);
+  State::draw(t.state, t.target);
+  Particles::draw(t.particles, t.target);
+
+  if (t.isLoaded) {
+    Hud::update(t.hud, t.state);
+    Hud::draw(t.hud, t.target);
+
+    if (t.state.name != State::Name::PLAYING) {
+      Menu::draw(t.menu, t.target);
+    }
+
+    Overlay::draw(t.overlay, t.target, t.droppedTime, t.stepsLastFrame,
+                  t.frameAllocations, t.stepAllocations);
+  }
+
+  {
+    PROFILE_ZONE("display");
+    t.window->display();
+  }
+  Render::endFrame(t.target);
+
+  if (t.startup.firstFrame == sf::Time::Zero) {
+    t.startup.firstFrame = Latency::now();
+  }
+
+  if (t.state.inputTimestamp != sf::Time::Zero) {
+    Latency::record(t.latency, Latency::now() - t.state.inputTimestamp);
+    t.state.inputTimestamp = sf::Time::Zero;
+  }
+
+  t.frameAllocations = Alloc::local() - before;
+  if (wasPlaying && t.state.name == State::Name::PLAYING) {
+    t.playedFrames += 1;
+    if (t.frameAllocations.allocations > 0) {
+      t.allocatingFrames += 1;
+    }
+  }
+
+  Scheduler::endFrame(t.scheduler);
+}
+
+void writeJson(const Startup &startup, std::ostream &out) {
+  out << "{\"window_ms\": " << startup.window.asMicroseconds() / 1000.0
+      << ", \"first_frame_ms\": "
+      << startup.firstFrame.asMicroseconds() / 1000.0
+      << ", \"assets_ms\": " << startup.assets.asMicroseconds() / 1000.0
+      << "}";
+}
+
+void writeAllocations(const T &t, std::ostream &out) {
+  out << "{\"played_frames\": " << t.playedFrames
+      << ", \"allocating_frames\": " << t.allocatingFrames
+      << ", \"sites\": ";
+  Alloc::writeSites(out, 10);
+  out << "}";
+}
+
+} // namespace Game
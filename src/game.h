@@ -0,0 +1,137 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include "alloc.h"
+#include "clock.h"
+#include "grid.h"
+#include "hud.h"
+#include "keys.h"
+#include "latency.h"
+#include "loader.h"
+#include "menu.h"
+#include "overlay.h"
+#include "particles.h"
+#include "recorder.h"
+#include "render.h"
+#include "replay.h"
+#include "scheduler.h"
+#include "sfx.h"
+#include "snapshot.h"
+#include "spectator.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Game {
+
+// Event delivered as if pollEvent had returned it at a given time
+struct Scripted {
+  sf::Time at;
+  sf::Event event;
+};
+
+struct Options {
+  Scheduler::Policy policy = Scheduler::PRECISE_SLEEP;
+  State::Handling handling;
+  // A virtual clock only moves when advanced by the caller
+  Clock::Kind clock = Clock::REAL;
+  // Music and sound effects, off for benchmarks
+  bool sound = true;
+  // Each game is recorded there when not empty, numbered after the first
+  std::string record;
+  // Played back instead of the keyboard when not empty
+  std::string replay;
+  // Every game is streamed there when not empty, see Spectator
+  std::string spectate;
+  // The game is saved there and resumed from it when not empty, unless it is
+  // recorded or replayed, see Snapshot
+  std::string save;
+};
+
+// Since the start of the process, see Latency::now
+struct Startup {
+  sf::Time window = sf::Time::Zero;
+  sf::Time firstFrame = sf::Time::Zero;
+  sf::Time assets = sf::Time::Zero;
+};
+
+// Everything the main loop works on. The menu callback and the texts keep
+// pointers into it: initialise in place, do not copy.
+struct T {
+  sf::RenderWindow *window;
+  Options options;
+  // The menu, the HUD and the overlay wait for it
+  Loader::T loader;
+  bool isLoaded = false;
+  // Plays the buffers of the loader, declared after it to stop first
+  Sfx::T sfx;
+  Startup startup;
+  Scheduler::T scheduler;
+  Render::T target;
+  Grid::T grid;
+  Overlay::T overlay;
+  Particles::T particles;
+  Hud::T hud;
+  Latency::T latency;
+  Menu::T menu;
+
+  Keys::T keys;
+  State::T state;
+  Recorder::T recorder;
+  int recordedGames = 0;
+  Spectator::T spectator;
+  Snapshot::Autosave autosave;
+  Replay::T replay;
+  bool isReplaying = false;
+  Clock::T clock;
+  // Not simulated yet, less than a step unless the catch-up is capped
+  sf::Time accumulatedTime = sf::Time::Zero;
+  // Index in turboFactors
+  std::size_t turbo = 0;
+  // Saved with F5 when profiling
+  int traces = 0;
+
+  // Simulation time given up to stay responsive, see maxStepsPerFrame
+  sf::Time droppedTime = sf::Time::Zero;
+  int stepsLastFrame = 0;
+
+  // Made by the main thread during the last frame, and by the steps of the
+  // current one
+  Alloc::Counters frameAllocations;
+  Alloc::Counters stepAllocations;
+  // Frames played from start to end, and how many of them allocated
+  std::uint64_t playedFrames = 0;
+  std::uint64_t allocatingFrames = 0;
+
+  // Sorted by time, used to inject synthetic input
+  std::vector<Scripted> script;
+  std::size_t scriptPosition = 0;
+};
+
+void init(T &t, sf::RenderWindow &window, Options options);
+
+// Saves the game, finishes the recording and the stream, and closes the
+// replay
+void stop(T &t);
+
+void writeJson(const Startup &startup, std::ostream &out);
+
+// Frames played, those that allocated and where, see Alloc
+void writeAllocations(const T &t, std::ostream &out);
+
+// Simulation time of something happening now, between two fixed steps
+sf::Time simulationTime(const T &t);
+
+// `timestamp` is when the event was received, see Latency::now
+void handleEvent(T &t, const sf::Event &event, sf::Time timestamp);
+
+// Handles the pending events, steps the simulation, draws and waits
+void frame(T &t);
+
+} // namespace Game
+
+#endif // !GAME_H
@@ -1,31 +1,49 @@
 #include "grid.h"
 #include "constants.h"
+#include "profile.h"
 #include <SFML/Graphics.hpp>
 
 namespace Grid {
 
-T init(sf::Vector2f origin) {
+constexpr float OUTLINE = 1.0f;
+
+void rectangle(sf::Vertex *quad, sf::Vector2f corner, sf::Vector2f size,
+               sf::Color color) {
+  quad[0] = sf::Vertex(corner, color);
+  quad[1] = sf::Vertex(corner + sf::Vector2f(size.x, 0.f), color);
+  quad[2] = sf::Vertex(corner + size, color);
+  quad[3] = sf::Vertex(corner + sf::Vector2f(0.f, size.y), color);
+}
+
+T init(sf::Vector2f origin, int columns, int rows, float size) {
   T t = T();
-  auto grid = t.grid;
-  for (int row = 0; row < NUMROWS; ++row) {
-    for (int col = 0; col < NUMCOLS; ++col) {
-      float x = (col + origin.x) * SQUARESIZE;
-      float y = (row + origin.y) * SQUARESIZE;
-      grid[row][col].setSize(sf::Vector2f(SQUARESIZE, SQUARESIZE));
-      grid[row][col].setOutlineThickness(1.0f);
-      grid[row][col].setOutlineColor(COLOR_OUTLINE);
-      grid[row][col].setPosition(x, y);
+  // A filled cell then its outline around it, as a rectangle shape would,
+  // so that the outlines of the next cells are partly drawn over
+  t.cells.setPrimitiveType(sf::Quads);
+  t.cells.resize(std::size_t(rows) * columns * 5 * 4);
+  sf::Vertex *quad = &t.cells[0];
+  for (int row = 0; row < rows; ++row) {
+    for (int col = 0; col < columns; ++col) {
+      sf::Vector2f corner(origin.x + col * size, origin.y + row * size);
+      sf::Vector2f outside = corner - sf::Vector2f(OUTLINE, OUTLINE);
+      float length = size + 2 * OUTLINE;
+      rectangle(quad, corner, sf::Vector2f(size, size), sf::Color::White);
+      rectangle(quad + 4, outside, sf::Vector2f(length, OUTLINE),
+                COLOR_OUTLINE);
+      rectangle(quad + 8, outside + sf::Vector2f(0.f, size + OUTLINE),
+                sf::Vector2f(length, OUTLINE), COLOR_OUTLINE);
+      rectangle(quad + 12, corner - sf::Vector2f(OUTLINE, 0.f),
+                sf::Vector2f(OUTLINE, size), COLOR_OUTLINE);
+      rectangle(quad + 16, corner + sf::Vector2f(size, 0.f),
+                sf::Vector2f(OUTLINE, size), COLOR_OUTLINE);
+      quad += 5 * 4;
     }
   }
   return t;
 }
 
-void draw(T t, sf::RenderWindow &window) {
-  auto grid = t.grid;
-  for (int row = 0; row < NUMROWS; ++row) {
-    for (int col = 0; col < NUMCOLS; ++col) {
-      window.draw(grid[row][col]);
-    }
-  }
+void draw(const T &t, Render::T &target) {
+  PROFILE_ZONE("Grid::draw");
+  Render::draw(target, t.cells);
 }
 } // namespace Grid
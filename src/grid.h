@@ -2,15 +2,20 @@
 #define GRID_H
 
 #include "constants.h"
+#include "render.h"
 
 namespace Grid {
+// The empty cells behind the board, built once and drawn in one call
 struct T {
-  sf::RectangleShape grid[NUMROWS][NUMCOLS];
+  sf::VertexArray cells;
 };
 
-T init(sf::Vector2f origin);
+// `origin` is the top left corner of the grid and `size` the side of a cell,
+// in pixels
+T init(sf::Vector2f origin, int columns = NUMCOLS, int rows = NUMROWS,
+       float size = SQUARESIZE);
 
-void draw(T t, sf::RenderWindow &window);
+void draw(const T &t, Render::T &target);
 
 } // namespace Grid
 
@@ -0,0 +1,130 @@
+#include "hud.h"
+#include "constants.h"
+#include "piece.h"
+#include "profile.h"
+#include "render.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <string>
+
+namespace Hud {
+
+constexpr const char *LABELS[] = {"SCORE", "LINES", "LEVEL", "PPS"};
+constexpr float PREVIEW_SCALE = 0.5f;
+constexpr float PREVIEW_HEIGHT = 3.f * SQUARESIZE * PREVIEW_SCALE;
+// Every character of the values, longer than any of them
+constexpr const char *PRIMER = "0123456789.0123456789";
+
+int value(const State::T &state, Field field) {
+  switch (field) {
+  case SCORE:
+    return state.score;
+  case LINES:
+    return state.lines;
+  case LEVEL:
+    return State::level(state);
+  case PIECES_PER_SECOND:
+    // Shown with two decimals
+    return int(State::piecesPerSecond(state) * 100.f);
+  default:
+    return 0;
+  }
+}
+
+std::string format(Field field, int value) {
+  if (field != PIECES_PER_SECOND) {
+    return std::to_string(value);
+  }
+  std::string decimals = std::to_string(value % 100);
+  if (decimals.size() == 1) {
+    decimals = "0" + decimals;
+  }
+  return std::to_string(value / 100) + "." + decimals;
+}
+
+void setText(sf::Text &text, const sf::Font &font, sf::Vector2f position,
+             unsigned size) {
+  text.setFont(font);
+  text.setCharacterSize(size);
+  text.setFillColor(sf::Color::White);
+  text.setPosition(position);
+}
+
+void init(T &t, const sf::Font &font, sf::Vector2f origin) {
+  unsigned size = SQUARESIZE / 2.f;
+  float lineHeight = SQUARESIZE * .7f;
+  sf::Vector2f position = origin;
+
+  for (int field = 0; field < NUMBER_OF_FIELDS; ++field) {
+    setText(t.labels[field], font, position, size);
+    t.labels[field].setFillColor(COLOR_OUTLINE);
+    t.labels[field].setString(LABELS[field]);
+    position.y += lineHeight;
+
+    setText(t.values[field], font, position, size);
+    Render::primeText(t.values[field], t.scratch, PRIMER);
+    position.y += lineHeight * 1.5f;
+  }
+
+  setText(t.nextLabel, font, position, size);
+  t.nextLabel.setFillColor(COLOR_OUTLINE);
+  t.nextLabel.setString("NEXT");
+
+  t.nextPieces.setPrimitiveType(sf::Quads);
+  t.nextPieces.resize(Piece::QUEUE_SIZE * 4 * 4);
+
+  // Force the first update to fill everything in
+  t.shown.fields.fill(-1);
+  t.shown.next.fill(-1);
+}
+
+void updateNextPieces(T &t, const State::T &state) {
+  sf::Vector2f anchor = t.nextLabel.getPosition() +
+                        sf::Vector2f(2.f * SQUARESIZE * PREVIEW_SCALE,
+                                     2.f * SQUARESIZE * PREVIEW_SCALE);
+  size_t vertex = 0;
+
+  for (size_t i = 0; i < Piece::QUEUE_SIZE; ++i) {
+    int type = state.piece.next[i];
+    // In the columns -2 to 1 and the rows 0 to 1 from the anchor
+    auto blocks = Piece::blocks(type, 1, sf::Vector2i(-1, 1));
+    sf::Color color = Piece::color(type);
+    float size = SQUARESIZE * PREVIEW_SCALE;
+
+    for (const auto &block : blocks) {
+      Render::square(&t.nextPieces[vertex], anchor + sf::Vector2f(block) * size,
+                     size, color);
+      vertex += 4;
+    }
+    anchor.y += PREVIEW_HEIGHT;
+  }
+  t.shown.next = state.piece.next;
+}
+
+void update(T &t, const State::T &state) {
+  PROFILE_ZONE("Hud::update");
+  for (int i = 0; i < NUMBER_OF_FIELDS; ++i) {
+    Field field = Field(i);
+    int current = value(state, field);
+    if (current != t.shown.fields[field]) {
+      Render::setString(t.values[field], t.scratch, format(field, current));
+      t.shown.fields[field] = current;
+    }
+  }
+
+  if (state.piece.next != t.shown.next) {
+    updateNextPieces(t, state);
+  }
+}
+
+void draw(const T &t, Render::T &target) {
+  PROFILE_ZONE("Hud::draw");
+  for (int field = 0; field < NUMBER_OF_FIELDS; ++field) {
+    Render::draw(target, t.labels[field]);
+    Render::draw(target, t.values[field]);
+  }
+  Render::draw(target, t.nextLabel);
+  Render::draw(target, t.nextPieces);
+}
+
+} // namespace Hud
@@ -0,0 +1,46 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include "piece.h"
+#include "render.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <array>
+
+namespace Hud {
+
+enum Field {
+  SCORE,
+  LINES,
+  LEVEL,
+  PIECES_PER_SECOND,
+  NUMBER_OF_FIELDS,
+};
+
+// Last values written to the texts. sf::Text only rebuilds its vertices
+// when its string changes, so texts are only touched when these do.
+struct Values {
+  std::array<int, NUMBER_OF_FIELDS> fields;
+  std::array<int, Piece::QUEUE_SIZE> next;
+};
+
+// The texts keep a pointer to the font, keep it alive
+struct T {
+  std::array<sf::Text, NUMBER_OF_FIELDS> labels;
+  std::array<sf::Text, NUMBER_OF_FIELDS> values;
+  sf::Text nextLabel;
+  sf::VertexArray nextPieces;
+  Values shown;
+  // Reused to set the values, see Render::setString
+  sf::String scratch;
+};
+
+void init(T &t, const sf::Font &font, sf::Vector2f origin);
+
+void update(T &t, const State::T &state);
+
+void draw(const T &t, Render::T &target);
+
+} // namespace Hud
+
+#endif // !HUD_H
@@ -1,24 +1,80 @@
 #include "keys.h"
 #include <sfml/graphics.hpp>
-#include <unordered_set>
 
 namespace Keys {
 
+bool isValid(sf::Keyboard::Key key) {
+  return key >= 0 && key < sf::Keyboard::KeyCount;
+}
+
 bool isAlreadyPressed(const T &t, sf::Keyboard::Key key) {
-  return t.pressed.count(key) > 0;
+  return isValid(key) && t.pressed[key];
 }
 
-void addPressed(T &t, sf::Keyboard::Key key) { t.pressed.emplace(key); }
+bool isHeld(const T &t, sf::Keyboard::Key key) {
+  return isValid(key) && t.held[key];
+}
 
-void toBeReleased(T &t, sf::Keyboard::Key key) {
-  t.toBeReleased.push_back(key);
+bool push(T &t, const Event &event) {
+  if (!isValid(event.key) || t.write - t.read == CAPACITY) {
+    return false;
+  }
+  t.held[event.key] = event.pressed;
+  t.events[t.write % CAPACITY] = event;
+  t.write += 1;
+  return true;
 }
 
-void removePressed(T &t) {
-  for (const auto &key : t.toBeReleased) {
-    t.pressed.erase(key);
+bool pop(T &t, sf::Time until, Event &event) {
+  if (t.read == t.write || t.events[t.read % CAPACITY].time >= until) {
+    return false;
   }
-  t.toBeReleased.clear();
+  event = t.events[t.read % CAPACITY];
+  t.pressed[event.key] = event.pressed;
+  t.read += 1;
+  return true;
+}
+
+std::size_t countBefore(const T &t, sf::Time until) {
+  std::size_t count = 0;
+  while (t.read + count != t.write && peek(t, count).time < until) {
+    count += 1;
+  }
+  return count;
+}
+
+const Event &peek(const T &t, std::size_t index) {
+  return t.events[(t.read + index) % CAPACITY];
+}
+
+void press(T &t, sf::Keyboard::Key key) {
+  if (isValid(key)) {
+    t.held[key] = true;
+  }
+}
+
+void release(T &t, sf::Keyboard::Key key) {
+  if (isValid(key)) {
+    t.held[key] = false;
+  }
+}
+
+void releaseAll(T &t, sf::Time time) {
+  for (int key = 0; key < sf::Keyboard::KeyCount; ++key) {
+    if (t.pressed[key]) {
+      // Only the simulation releases it, it may still be held on the keyboard
+      bool held = t.held[key];
+      push(t, {sf::Keyboard::Key(key), false, time, sf::Time::Zero});
+      t.held[key] = held;
+    }
+  }
+}
+
+void clear(T &t) { t.read = t.write; }
+
+void reset(T &t) {
+  clear(t);
+  t.pressed.reset();
 }
 
 } // namespace Keys
@@ -1,22 +1,64 @@
 #ifndef KEYS_H
 #define KEYS_H
 
+#include <array>
+#include <bitset>
+#include <cstddef>
 #include <sfml/graphics.hpp>
-#include <unordered_set>
 
 namespace Keys {
+
+// Must be a power of two
+constexpr std::size_t CAPACITY = 64;
+
+struct Event {
+  sf::Keyboard::Key key;
+  bool pressed;
+  // In simulation time, decides in which step the event is consumed
+  sf::Time time;
+  // For latency measurements
+  sf::Time timestamp;
+};
+
 struct T {
-  std::unordered_set<sf::Keyboard::Key> pressed;
-  std::vector<sf::Keyboard::Key> toBeReleased;
+  // As seen by the simulation, updated when events are consumed
+  std::bitset<sf::Keyboard::KeyCount> pressed;
+  // As received from the window, used to ignore the OS key repeat
+  std::bitset<sf::Keyboard::KeyCount> held;
+
+  // Ring buffer of events waiting for the simulation, in order
+  std::array<Event, CAPACITY> events;
+  std::size_t read = 0;
+  std::size_t write = 0;
 };
 
 bool isAlreadyPressed(const T &t, sf::Keyboard::Key key);
 
-void addPressed(T &t, sf::Keyboard::Key key);
+bool isHeld(const T &t, sf::Keyboard::Key key);
+
+// Returns false, and drops the event, when the buffer is full
+bool push(T &t, const Event &event);
+
+// Pops the next event happening before `until`, if any
+bool pop(T &t, sf::Time until, Event &event);
+
+// Number of pending events happening before `until`, and access to them
+std::size_t countBefore(const T &t, sf::Time until);
+const Event &peek(const T &t, std::size_t index);
+
+// For keys used outside of the game: only what the window reported changes,
+// the simulation only sees events
+void press(T &t, sf::Keyboard::Key key);
+void release(T &t, sf::Keyboard::Key key);
+
+// Releases, through events, every key pressed for the simulation
+void releaseAll(T &t, sf::Time time);
 
-void toBeReleased(T &t, sf::Keyboard::Key key);
+// Drops the pending events
+void clear(T &t);
 
-void removePressed(T &t);
+// Drops the pending events and releases everything at once, for a new game
+void reset(T &t);
 
 } // namespace Keys
 
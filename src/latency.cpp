@@ -0,0 +1,43 @@
+#include "latency.h"
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <ostream>
+
+namespace Latency {
+
+sf::Time now() {
+  static sf::Clock clock;
+  return clock.getElapsedTime() + sf::microseconds(1);
+}
+
+void record(T &t, sf::Time latency) {
+  float milliseconds = latency.asMicroseconds() / 1000.f;
+  std::size_t bucket = std::size_t(std::max(0.f, milliseconds) / BUCKET_MS);
+  t.histogram[std::min(bucket, BUCKETS - 1)] += 1;
+  t.samples += 1;
+}
+
+float percentile(const T &t, float fraction) {
+  if (t.samples == 0) {
+    return 0.f;
+  }
+  std::size_t rank = std::size_t(fraction * (t.samples - 1));
+  std::size_t seen = 0;
+  for (std::size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+    seen += t.histogram[bucket];
+    if (seen > rank) {
+      // Upper bound of the bucket
+      return (bucket + 1) * BUCKET_MS;
+    }
+  }
+  return BUCKETS * BUCKET_MS;
+}
+
+void writeJson(const T &t, std::ostream &out) {
+  out << "{\"samples\": " << t.samples
+      << ", \"p50_ms\": " << percentile(t, .5f)
+      << ", \"p99_ms\": " << percentile(t, .99f)
+      << ", \"max_ms\": " << percentile(t, 1.f) << "}";
+}
+
+} // namespace Latency
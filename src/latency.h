@@ -0,0 +1,34 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <SFML/System.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace Latency {
+
+constexpr std::size_t BUCKETS = 400;
+// Resolution of the histogram, the last bucket collects everything above
+constexpr float BUCKET_MS = 0.25f;
+
+// Input-to-photon latency: from the moment a key press is returned by
+// pollEvent to the return of the first display() showing its effect
+struct T {
+  std::array<std::uint32_t, BUCKETS> histogram = {};
+  std::size_t samples = 0;
+};
+
+// Monotonic time since the start of the process, never zero
+sf::Time now();
+
+void record(T &t, sf::Time latency);
+
+float percentile(const T &t, float fraction);
+
+void writeJson(const T &t, std::ostream &out);
+
+} // namespace Latency
+
+#endif // !LATENCY_H
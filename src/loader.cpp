@@ -0,0 +1,43 @@
+#include "loader.h"
+#include "assets.h"
+#include "sfx.h"
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <iostream>
+#include <thread>
+
+namespace Loader {
+
+void load(T &t) {
+  auto font = Assets::get(Assets::FONT);
+  if (!t.font.loadFromMemory(font.data(), font.size())) {
+    std::cerr << "Cannot load the font" << std::endl;
+  }
+
+  auto theme = Assets::get(Assets::MUSIC);
+  if (!t.music.openFromMemory(theme.data(), theme.size())) {
+    std::cerr << "Cannot load the music" << std::endl;
+  }
+  t.music.setLoop(true);
+
+  Sfx::synthesise(t.effects);
+
+  t.ready.store(true, std::memory_order_release);
+}
+
+void start(T &t) {
+  if (t.thread.joinable() || isReady(t)) {
+    return;
+  }
+  t.thread = std::thread(load, std::ref(t));
+}
+
+bool isReady(const T &t) { return t.ready.load(std::memory_order_acquire); }
+
+void wait(T &t) {
+  if (t.thread.joinable()) {
+    t.thread.join();
+  }
+}
+
+} // namespace Loader
@@ -0,0 +1,34 @@
+#ifndef LOADER_H
+#define LOADER_H
+
+#include "sfx.h"
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <thread>
+
+namespace Loader {
+
+// Decodes the assets on a background thread, so that the first frame does
+// not wait for them
+struct T {
+  std::thread thread;
+  std::atomic<bool> ready = false;
+  sf::Font font;
+  sf::Music music;
+  Sfx::Buffers effects;
+};
+
+// The thread writes into t: initialise in place, do not copy. Does nothing
+// when already started.
+void start(T &t);
+
+// Once true, the assets can be used from any thread
+bool isReady(const T &t);
+
+// Blocks until the assets are ready
+void wait(T &t);
+
+} // namespace Loader
+
+#endif // !LOADER_H
@@ -0,0 +1,236 @@
+#include "constants.h"
+#include "net.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <vector>
+
+// Load generator of tetris_server: opens matches, plays them with random
+// keys and checks that the server still steps every one of them at 60 Hz.
+// Usage: tetris_loadgen [--connect=/path/or/port] [--matches=N] [--seconds=S]
+//                       [--ramp]
+// With --ramp the matches double from N until the server falls behind, the
+// last load it kept up with is its ceiling. Results are JSON on stdout.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Time for the matches to start before measuring
+constexpr double WARM_UP_SECONDS = 1.0;
+// A player changes its keys that often, a few presses a second
+constexpr auto INPUT_INTERVAL = std::chrono::milliseconds(100);
+// Of the fixed steps, under which the server is behind
+constexpr double KEEPING_UP = 0.95;
+
+struct Client {
+  Net::Connection connection;
+  // STATE messages, one per step of the server
+  std::uint64_t steps = 0;
+  int workers = 0;
+  int held = -1;
+};
+
+struct Run {
+  int matches = 0;
+  int workers = 0;
+  double seconds = 0.0;
+  // Steps per second received by the slowest client, and on average
+  double slowest = 0.0;
+  double average = 0.0;
+  std::uint64_t bytes = 0;
+  bool keptUp = false;
+};
+
+double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Two sockets per match, the default limit is soon reached
+void raiseDescriptorLimit() {
+  rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+    limit.rlim_cur = limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &limit);
+  }
+}
+
+void press(Client &client, std::minstd_rand &gen) {
+  // Releases the key held, or presses a new one
+  if (client.held >= 0) {
+    Net::append(client.connection, Net::KEY,
+                Net::KeyMessage{std::uint8_t(client.held), 0});
+    client.held = -1;
+    return;
+  }
+  client.held = int(gen() % Net::KEYS);
+  Net::append(client.connection, Net::KEY,
+              Net::KeyMessage{std::uint8_t(client.held), 1});
+}
+
+// Returns the bytes received
+std::uint64_t receive(Client &client) {
+  std::size_t before = client.connection.in.size();
+  Net::receive(client.connection);
+  std::uint64_t bytes = client.connection.in.size() - before;
+  Net::consume(client.connection, [&client](Net::Type type,
+                                            const char *payload,
+                                            std::size_t size) {
+    if (type == Net::STATE) {
+      client.steps += 1;
+    } else if (type == Net::WELCOME && size == sizeof(Net::Welcome)) {
+      client.workers = Net::read<Net::Welcome>(payload).workers;
+    }
+  });
+  return bytes;
+}
+
+bool measure(const std::string &address, int matches, double seconds,
+             Run &run) {
+  std::vector<Client> clients(2 * matches);
+  for (Client &client : clients) {
+    client.connection.fd = Net::connect(address);
+    if (client.connection.fd < 0) {
+      for (Client &opened : clients) {
+        Net::close(opened.connection);
+      }
+      return false;
+    }
+  }
+  int epoll = epoll_create1(0);
+  for (Client &client : clients) {
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.ptr = &client;
+    epoll_ctl(epoll, EPOLL_CTL_ADD, client.connection.fd, &event);
+  }
+
+  std::minstd_rand gen(matches);
+  std::vector<epoll_event> events(clients.size());
+  auto start = Clock::now();
+  auto nextInput = start;
+  bool isMeasuring = false;
+  std::uint64_t bytes = 0;
+  while (secondsSince(start) < WARM_UP_SECONDS + seconds) {
+    if (!isMeasuring && secondsSince(start) >= WARM_UP_SECONDS) {
+      isMeasuring = true;
+      bytes = 0;
+      for (Client &client : clients) {
+        client.steps = 0;
+      }
+    }
+
+    int count = epoll_wait(epoll, events.data(), int(events.size()), 1);
+    for (int i = 0; i < count; ++i) {
+      bytes += receive(*static_cast<Client *>(events[i].data.ptr));
+    }
+
+    if (Clock::now() >= nextInput) {
+      nextInput += INPUT_INTERVAL;
+      for (Client &client : clients) {
+        press(client, gen);
+        Net::flush(client.connection);
+      }
+    }
+  }
+
+  run = Run{};
+  run.matches = matches;
+  run.seconds = seconds;
+  run.slowest = 1e9;
+  for (Client &client : clients) {
+    double rate = client.steps / seconds;
+    run.slowest = std::min(run.slowest, rate);
+    run.average += rate / clients.size();
+    run.workers = std::max(run.workers, client.workers);
+    Net::close(client.connection);
+  }
+  run.bytes = bytes;
+  run.keptUp = run.slowest >= KEEPING_UP * fixedNumberOfFrames;
+  close(epoll);
+  return true;
+}
+
+void writeJson(const Run &run, std::ostream &out) {
+  out << "    {\"matches\": " << run.matches << ", \"workers\": " << run.workers
+      << ", \"seconds\": " << run.seconds
+      << ", \"slowest_steps_per_second\": " << run.slowest
+      << ", \"average_steps_per_second\": " << run.average
+      << ", \"bytes_per_second_per_client\": "
+      << run.bytes / run.seconds / (2 * run.matches)
+      << ", \"kept_up\": " << run.keptUp << "}";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string address = "/tmp/tetris.sock";
+  int matches = 100;
+  double seconds = 5.0;
+  bool ramp = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.rfind("--connect=", 0) == 0) {
+      address = arg.substr(10);
+    } else if (arg.rfind("--matches=", 0) == 0) {
+      if (!Net::parse(arg.substr(10), matches) || matches < 1) {
+        std::cerr << "Invalid option: " << arg << std::endl;
+        return 1;
+      }
+    } else if (arg.rfind("--seconds=", 0) == 0) {
+      if (!Net::parse(arg.substr(10), seconds) || !std::isfinite(seconds) ||
+          seconds <= 0.0) {
+        std::cerr << "Invalid option: " << arg << std::endl;
+        return 1;
+      }
+    } else if (arg == "--ramp") {
+      ramp = true;
+    }
+  }
+  raiseDescriptorLimit();
+
+  std::vector<Run> runs;
+  Run ceiling;
+  for (;; matches *= 2) {
+    Run run;
+    if (!measure(address, matches, seconds, run)) {
+      break;
+    }
+    runs.push_back(run);
+    if (!run.keptUp) {
+      break;
+    }
+    ceiling = run;
+    if (!ramp) {
+      break;
+    }
+  }
+  if (runs.empty()) {
+    return 1;
+  }
+
+  std::cout << "{\n  \"runs\": [\n";
+  for (std::size_t i = 0; i < runs.size(); ++i) {
+    writeJson(runs[i], std::cout);
+    std::cout << (i + 1 < runs.size() ? ",\n" : "\n");
+  }
+  std::cout << "  ]";
+  // A single run does not look for the ceiling
+  if (ramp) {
+    std::cout << ",\n  \"ceiling_matches\": " << ceiling.matches
+              << ",\n  \"matches_per_core\": "
+              << (ceiling.workers > 0
+                      ? double(ceiling.matches) / ceiling.workers
+                      : 0.0);
+  }
+  std::cout << "\n}" << std::endl;
+  return 0;
+}
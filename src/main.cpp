@@ -1,13 +1,17 @@
 #include "constants.h"
-#include "keys.h"
-#include "menu.h"
+#include "game.h"
+#include "latency.h"
+#include "loader.h"
+#include "replay.h"
+#include "scheduler.h"
 #include "state.h"
+#include "wall.h"
 
-#include "tetris_sound.h"
-
-#include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
+#include <charconv>
+#include <cmath>
 #include <iostream>
+#include <string>
 
 // Data oriented programming
 
@@ -37,125 +41,137 @@
 //   update menu
 //   update blocks
 //   draw
-constexpr float windowWidth = (NUMCOLS + 2 * OFFSET_GRID) * SQUARESIZE;
-constexpr float windowHeight = (NUMROWS + 2 * OFFSET_GRID) * SQUARESIZE;
-
-int main() {
-  sf::VideoMode videoMode = sf::VideoMode(windowWidth, windowHeight);
-  sf::RenderWindow window(videoMode, "Tetris (SFML rocks!)");
-  sf::Clock clock;
-  sf::Event event;
+// The whole of `text` must be the number
+template <typename Number> bool parse(const std::string &text, Number &value) {
+  const char *end = text.data() + text.size();
+  auto [parsed, error] = std::from_chars(text.data(), end, value);
+  return error == std::errc() && parsed == end;
+}
 
-  Keys::T keys;
-  State::T state = State::init();
-  float accumulatedTime = 0.0f;
+int invalid(const std::string &arg) {
+  std::cerr << "Invalid option: " << arg << std::endl;
+  return 1;
+}
 
-  sf::Music music;
-  music.openFromMemory(tetris_theme_ogg, tetris_theme_ogg_len);
-  music.play();
-  music.setLoop(true);
+// Replays a recorded game as fast as possible, without a window
+int replayHeadless(const std::string &path) {
+  Replay::T replay;
+  if (!Replay::open(replay, path)) {
+    std::cerr << "Cannot open replay " << path << std::endl;
+    return 1;
+  }
 
-  Menu::T menu = Menu::init_main([&state, &window, &accumulatedTime,
-                                  &clock](Menu::Item choice, float speed) {
-    if (holds_alternative<Menu::Single_choice>(choice)) {
-      auto single_choice = get<Menu::Single_choice>(choice);
+  sf::Clock clock;
+  State::T state = Replay::run(replay, Replay::init(replay));
+  float wall = clock.getElapsedTime().asSeconds();
+  Replay::close(replay);
+
+  std::cout << "{\"ticks\": " << state.tick << ", \"score\": " << state.score
+            << ", \"lines\": " << state.lines
+            << ", \"pieces\": " << state.pieces
+            << ", \"wall_ms\": " << wall * 1000.f
+            << ", \"speedup\": " << state.time.asSeconds() / wall << "}"
+            << std::endl;
+  return 0;
+}
 
-      if (single_choice.name == "Restart") {
-        state = State::init();
+int main(int argc, char **argv) {
+  // Startup times are measured from here
+  Latency::now();
+
+  Game::Options options;
+  bool headless = false;
+  // Several boards instead of the game, see Wall
+  int boards = 0;
+  int players = 0;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.rfind("--loop=", 0) == 0) {
+      if (!Scheduler::parsePolicy(arg.substr(7), options.policy)) {
+        return 1;
       }
-
-      if (single_choice.name == "Play" || single_choice.name == "Restart") {
-        state.name = State::Name::PLAYING;
-        state.speed = speed;
-        accumulatedTime = 0.f;
-        clock.restart();
-      } else if (single_choice.name == "Quit") {
-        window.close();
-      } else {
-        std::cerr << "Received invalid choice: " << single_choice.name
-                  << std::endl;
-        throw std::invalid_argument("invalid choice");
+    } else if (arg.rfind("--das=", 0) == 0) {
+      int das = 0;
+      if (!parse(arg.substr(6), das) || das < 0) {
+        return invalid(arg);
       }
-
-    } else {
-      auto multiple_choice = get<Menu::Multiple_choice>(choice);
-      if (multiple_choice.name == "Speed") {
-        state.name = State::Name::PLAYING;
-        state.speed = speed;
-        accumulatedTime = 0.f;
-        clock.restart();
-      } else {
-        std::cerr << "Received invalid choice: " << multiple_choice.name
-                  << std::endl;
-        throw std::invalid_argument("invalid choice");
+      options.handling.das = sf::milliseconds(das);
+    } else if (arg.rfind("--arr=", 0) == 0) {
+      int arr = 0;
+      if (!parse(arg.substr(6), arr) || arr < 0) {
+        return invalid(arg);
       }
-    }
-  });
-
-  while (window.isOpen()) {
-    while (window.pollEvent(event)) {
-      if (event.type == sf::Event::Closed) {
-        window.close();
+      options.handling.arr = sf::milliseconds(arr);
+    } else if (arg.rfind("--sdf=", 0) == 0) {
+      // Soft dropping is never slower than falling
+      float sdf = 0.f;
+      if (!parse(arg.substr(6), sdf) || !std::isfinite(sdf) || sdf < 1.f) {
+        return invalid(arg);
       }
-
-      if (event.type == sf::Event::KeyPressed) {
-        auto key = event.key.code;
-        if (Keys::isAlreadyPressed(keys, key)) {
-          continue;
-        }
-        if (state.name == State::Name::PLAYING) {
-          if (key == sf::Keyboard::Escape) {
-            state.name = State::Name::SHOWING_FIRST_MENU;
-          } else {
-            state = State::manageKeyPressed(state, key, true);
-          }
-        } else if (state.name == State::Name::SHOWING_FIRST_MENU) {
-          if (key == sf::Keyboard::Escape) {
-            menu.selection = 0;
-            Menu::choose(menu);
-          } else if (key == sf::Keyboard::Down) {
-
-            menu = Menu::selectDown(menu);
-          } else if (key == sf::Keyboard::Up) {
-            menu = Menu::selectUp(menu);
-          } else if (key == sf::Keyboard::Left) {
-            menu = Menu::selectLeft(menu);
-          } else if (key == sf::Keyboard::Right) {
-            menu = Menu::selectRight(menu);
-          } else if (key == sf::Keyboard::Enter) {
-            Menu::choose(menu);
-          }
-        }
-        Keys::addPressed(keys, key);
+      options.handling.softDropFactor = sdf;
+    } else if (arg.rfind("--record=", 0) == 0) {
+      options.record = arg.substr(9);
+    } else if (arg.rfind("--replay=", 0) == 0) {
+      options.replay = arg.substr(9);
+    } else if (arg.rfind("--spectate=", 0) == 0) {
+      options.spectate = arg.substr(11);
+    } else if (arg.rfind("--save=", 0) == 0) {
+      options.save = arg.substr(7);
+    } else if (arg == "--headless") {
+      headless = true;
+    } else if (arg == "--versus") {
+      boards = 2;
+      players = 2;
+    } else if (arg.rfind("--wall=", 0) == 0) {
+      if (!parse(arg.substr(7), boards) || boards < 1 ||
+          boards > Wall::MAX_BOARDS) {
+        return invalid(arg);
       }
-
-      if (event.type == sf::Event::KeyReleased) {
-        Keys::toBeReleased(keys, event.key.code);
+    } else if (arg.rfind("--players=", 0) == 0) {
+      if (!parse(arg.substr(10), players) || players < 0 ||
+          players > Wall::MAX_PLAYERS) {
+        return invalid(arg);
       }
     }
+  }
+  // The players play the first boards of the wall
+  if (players > boards) {
+    std::cerr << "More players than boards: " << players << std::endl;
+    return 1;
+  }
 
-    window.clear(COLOR_BACKGROUND);
+  if (boards > 0) {
+    return Wall::run(boards, players, options.handling);
+  }
 
-    if (state.name == State::Name::PLAYING) {
-      accumulatedTime += clock.restart().asSeconds();
+  if (headless) {
+    return replayHeadless(options.replay);
+  }
 
-      while (accumulatedTime >= fixedTimeStep) {
-        state = State::manageFixedStep(state, keys);
+  // The assets are decoded while the window is created
+  Game::T game;
+  Loader::start(game.loader);
 
-        accumulatedTime -= fixedTimeStep;
-      }
-    }
+  sf::VideoMode videoMode = sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT);
+  sf::RenderWindow window(videoMode, "Tetris (SFML rocks!)");
+  Game::init(game, window, options);
 
-    State::draw(state, window);
+  while (window.isOpen()) {
+    Game::frame(game);
+  }
+  Game::stop(game);
 
-    if (state.name == State::Name::SHOWING_FIRST_MENU) {
-      Menu::draw(menu, window);
-    }
+  std::cout << "startup: ";
+  Game::writeJson(game.startup, std::cout);
+  std::cout << std::endl;
 
-    window.display();
+  std::cout << "input latency: ";
+  Latency::writeJson(game.latency, std::cout);
+  std::cout << std::endl;
 
-    Keys::removePressed(keys);
-  }
+  std::cout << "allocations: ";
+  Game::writeAllocations(game, std::cout);
+  std::cout << std::endl;
 
   return 0;
 }
@@ -0,0 +1,86 @@
+#include "mapped.h"
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mapped {
+
+#ifdef _WIN32
+
+bool open(T &t, const std::string &path) {
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  GetFileSizeEx(file, &size);
+  HANDLE mapping =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    return false;
+  }
+
+  t.data = static_cast<const unsigned char *>(
+      MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+  t.size = std::size_t(size.QuadPart);
+  t.handle = mapping;
+  return t.data != nullptr;
+}
+
+void close(T &t) {
+  if (t.data != nullptr) {
+    UnmapViewOfFile(t.data);
+  }
+  if (t.handle != nullptr) {
+    CloseHandle(t.handle);
+  }
+  t = T{};
+}
+
+#else
+
+bool open(T &t, const std::string &path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat status;
+  if (fstat(fd, &status) != 0 || status.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+
+  void *data = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid once the descriptor is closed
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  t.data = static_cast<const unsigned char *>(data);
+  t.size = std::size_t(status.st_size);
+  return true;
+}
+
+void close(T &t) {
+  if (t.data != nullptr) {
+    munmap(const_cast<unsigned char *>(t.data), t.size);
+  }
+  t = T{};
+}
+
+#endif
+
+} // namespace Mapped
@@ -0,0 +1,22 @@
+#ifndef MAPPED_H
+#define MAPPED_H
+
+#include <cstddef>
+#include <string>
+
+namespace Mapped {
+
+// A whole file mapped read-only in memory
+struct T {
+  const unsigned char *data = nullptr;
+  std::size_t size = 0;
+  void *handle = nullptr;
+};
+
+bool open(T &t, const std::string &path);
+
+void close(T &t);
+
+} // namespace Mapped
+
+#endif // !MAPPED_H
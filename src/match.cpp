@@ -0,0 +1,147 @@
+#include "match.h"
+#include "constants.h"
+#include "keys.h"
+#include "net.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <bit>
+#include <iterator>
+
+namespace Match {
+
+// About a second of messages, a client further behind is dropped
+constexpr std::size_t MAX_PENDING = 64 * 1024;
+
+constexpr sf::Keyboard::Key KEYS[] = {
+    sf::Keyboard::Left, sf::Keyboard::Right, sf::Keyboard::Down,
+    sf::Keyboard::Up,   sf::Keyboard::Space, sf::Keyboard::Z,
+};
+static_assert(std::size(KEYS) == Net::KEYS, "a game key for each key");
+
+void start(T &t) {
+  t.rounds += 1;
+  // The same pieces for both
+  unsigned int seed = t.seed + t.rounds;
+  for (int player = 0; player < PLAYERS; ++player) {
+    Player &p = t.players[player];
+    p.state = State::init(seed);
+    p.state.name = State::Name::PLAYING;
+    Keys::reset(p.keys);
+    Net::append(p.connection, Net::WELCOME,
+                Net::Welcome{seed, std::uint8_t(player),
+                             std::uint8_t(t.workers)});
+  }
+}
+
+void init(T &t, int first, int second, unsigned int seed, int workers) {
+  t.players[0].connection.fd = first;
+  t.players[1].connection.fd = second;
+  t.gen.seed(seed);
+  t.seed = seed;
+  t.workers = workers;
+  start(t);
+}
+
+void handle(Player &player, Net::Type type, const char *payload,
+            std::size_t size) {
+  if (type != Net::KEY || size != sizeof(Net::KeyMessage)) {
+    return;
+  }
+  auto message = Net::read<Net::KeyMessage>(payload);
+  if (message.key >= Net::KEYS) {
+    return;
+  }
+  sf::Keyboard::Key key = KEYS[message.key];
+  bool pressed = message.pressed != 0;
+  // Repeats of a held key change nothing, like in the game
+  if (pressed && Keys::isHeld(player.keys, key)) {
+    return;
+  }
+  // Consumed by the next step
+  Keys::push(player.keys, {key, pressed, player.state.time, sf::Time::Zero});
+}
+
+void receive(T &t) {
+  for (Player &player : t.players) {
+    if (!Net::receive(player.connection)) {
+      t.isOver = true;
+    }
+    Net::consume(player.connection,
+                 [&player](Net::Type type, const char *payload,
+                           std::size_t size) {
+                   handle(player, type, payload, size);
+                 });
+  }
+}
+
+void sendBoard(Player &player) {
+  Net::Board board;
+  for (int row = 0; row < NUMROWS; ++row) {
+    board.rows[row] = player.state.board.rows[row];
+  }
+  Net::append(player.connection, Net::BOARD, board);
+}
+
+void step(T &t) {
+  for (Player &player : t.players) {
+    player.state = State::step(player.state, player.keys);
+  }
+
+  std::uniform_int_distribution<int> holes(0, NUMCOLS - 1);
+  for (int i = 0; i < PLAYERS; ++i) {
+    Player &player = t.players[i];
+    Player &opponent = t.players[1 - i];
+    const State::Events &events = player.state.events;
+    int cleared = std::popcount(events.clearedRows);
+    if (cleared > 1) {
+      opponent.state.garbage += cleared - 1;
+      opponent.state.garbageHole = holes(t.gen);
+    }
+    if (events.locked) {
+      sendBoard(player);
+    }
+    player.state.events = State::Events{};
+  }
+
+  bool lost = false;
+  for (int i = 0; i < PLAYERS; ++i) {
+    const State::T &state = t.players[i].state;
+    const State::T &opponent = t.players[1 - i].state;
+    Net::append(t.players[i].connection, Net::STATE,
+                Net::State{std::uint32_t(state.tick), state.score,
+                           std::uint16_t(state.lines),
+                           std::int8_t(state.piece.position.x),
+                           std::int8_t(state.piece.position.y),
+                           std::uint8_t(state.piece.orientation),
+                           std::uint8_t(state.piece.type),
+                           std::uint8_t(state.garbage),
+                           std::uint8_t(opponent.garbage)});
+    lost = lost || state.name == State::Name::LOST;
+  }
+
+  if (lost) {
+    for (Player &player : t.players) {
+      bool won = player.state.name != State::Name::LOST;
+      Net::append(player.connection, Net::END,
+                  Net::End{std::uint8_t(won)});
+    }
+    start(t);
+  }
+}
+
+void flush(T &t) {
+  for (Player &player : t.players) {
+    if (!Net::flush(player.connection) ||
+        player.connection.out.size() > MAX_PENDING) {
+      t.isOver = true;
+    }
+  }
+}
+
+void close(T &t) {
+  for (Player &player : t.players) {
+    Net::close(player.connection);
+  }
+}
+
+} // namespace Match
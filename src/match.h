@@ -0,0 +1,54 @@
+#ifndef MATCH_H
+#define MATCH_H
+
+#include "keys.h"
+#include "net.h"
+#include "state.h"
+#include <array>
+#include <random>
+
+// Two players on the server, each connected client plays its own board.
+// The server steps both States with the input it received, clients only
+// send keys and draw what they are told.
+namespace Match {
+
+constexpr int PLAYERS = 2;
+
+struct Player {
+  Net::Connection connection;
+  State::T state;
+  Keys::T keys;
+};
+
+struct T {
+  std::array<Player, PLAYERS> players;
+  // Columns of the holes in the garbage
+  std::mt19937 gen;
+  unsigned int seed = 0;
+  int rounds = 0;
+  // Worker threads of the server, told to the clients
+  int workers = 0;
+  // A client left, the match is to be closed
+  bool isOver = false;
+};
+
+// Both clients are told the match started, `workers` is for the load
+// generator
+void init(T &t, int first, int second, unsigned int seed, int workers);
+
+// Applies the keys received from both clients, ends the match when one
+// of them left
+void receive(T &t);
+
+// One fixed step of both boards. The lines cleared at once beyond the first
+// are sent to the opponent, and a new round starts when one of them lost.
+void step(T &t);
+
+// Sends what is queued, ends the match when a client does not keep up
+void flush(T &t);
+
+void close(T &t);
+
+} // namespace Match
+
+#endif // !MATCH_H
@@ -1,76 +1,94 @@
 #include "menu.h"
 #include "constants.h"
-#include "font.h"
+#include "profile.h"
+#include "render.h"
 #include <SFML/Graphics.hpp>
-#include <string>
-#include <variant>
-#include <vector>
-
-using namespace std;
+#include <stdexcept>
 
 namespace Menu {
 
-T init_main(function<void(Item choice, float speed)> handle_choice) {
-
-  sf::RectangleShape background;
-  background.setFillColor(sf::Color(252, 118, 109, 200));
-  background.setSize(sf::Vector2(WINDOW_WIDTH * .8f, WINDOW_HEIGHT * .8f));
-  background.setPosition(sf::Vector2(WINDOW_WIDTH * .1f, WINDOW_HEIGHT * .1f));
-
-  return T{"Menu",
-           0,
-           {
-               Menu::Single_choice{"Play"},
-               Menu::Single_choice{"Restart"},
-               Menu::Multiple_choice{"Speed", 0, {"1", "2", "3"}},
-               Menu::Single_choice{"Quit"},
-           },
-           handle_choice,
-           background};
+T init(std::function<void(Action action, float speed)> handle_choice) {
+  T t;
+  t.handle_choice = handle_choice;
+
+  t.background.setFillColor(sf::Color(252, 118, 109, 200));
+  t.background.setSize(sf::Vector2(WINDOW_WIDTH * .8f, WINDOW_HEIGHT * .8f));
+  t.background.setPosition(
+      sf::Vector2(WINDOW_WIDTH * .1f, WINDOW_HEIGHT * .1f));
+
+  return t;
 }
 
-float getSpeed(T t) {
-  auto speed_choice = get<Multiple_choice>(t.items[2]);
-  auto selection = speed_choice.choices[speed_choice.selection];
-  if (selection == "1") {
-    return 2.f;
-  } else if (selection == "2") {
-    return 4.f;
-  } else if (selection == "3") {
-    return 6.f;
+const Page &page(const T &t) { return *t.pages[t.depth - 1]; }
+
+float getSpeed(const T &t) { return SPEEDS[t.settings[SPEED]].value; }
+
+void open(T &t, const Page &page) {
+  t.pages[0] = &page;
+  t.depth = 1;
+  t.selection = 0;
+}
+
+void push(T &t, const Page &page) {
+  if (t.depth == MAX_DEPTH) {
+    throw std::length_error("too many nested menus");
   }
-  throw std::invalid_argument("invalid speed");
+  t.pages[t.depth] = &page;
+  t.depth += 1;
+  t.selection = 0;
 }
 
-T selectVertical(T t, size_t offset) {
-  t.selection += t.items.size() + offset;
-  t.selection %= t.items.size();
-  return t;
+void selectVertical(T &t, std::size_t offset) {
+  std::size_t size = page(t).items.size();
+  t.selection += size + offset;
+  t.selection %= size;
 }
 
-T selectHorizontal(T t, size_t offset) {
-  auto selected = t.items[t.selection];
+void selectHorizontal(T &t, std::size_t offset) {
+  const Item &selected = page(t).items[t.selection];
 
-  if (holds_alternative<Single_choice>(selected)) {
-    return t;
+  if (selected.options.empty()) {
+    return;
   }
 
-  auto multiple_choice = get<Multiple_choice>(selected);
-  multiple_choice.selection += offset;
-  multiple_choice.selection += multiple_choice.choices.size();
-  multiple_choice.selection %= multiple_choice.choices.size();
-  t.items[t.selection] = multiple_choice;
-
-  return t;
+  std::size_t &option = t.settings[selected.setting];
+  option += offset;
+  option += selected.options.size();
+  option %= selected.options.size();
 }
 
-T selectUp(T t) { return selectVertical(t, -1); }
-T selectDown(T t) { return selectVertical(t, +1); }
-
-T selectRight(T t) { return selectHorizontal(t, +1); }
-T selectLeft(T t) { return selectHorizontal(t, -1); }
+void selectUp(T &t) { selectVertical(t, -1); }
+void selectDown(T &t) { selectVertical(t, +1); }
+
+void selectRight(T &t) { selectHorizontal(t, +1); }
+void selectLeft(T &t) { selectHorizontal(t, -1); }
+
+void choose(T &t) {
+  Action action = page(t).items[t.selection].action;
+
+  switch (action) {
+  case RESTART:
+    push(t, CONFIRM_RESTART);
+    break;
+  case OPEN_SETTINGS:
+    push(t, SETTINGS);
+    break;
+  case BACK:
+    cancel(t);
+    break;
+  default:
+    t.handle_choice(action, getSpeed(t));
+    break;
+  }
+}
 
-void choose(T t) { t.handle_choice(t.items[t.selection], getSpeed(t)); }
+void cancel(T &t) {
+  // Escape on the root page must not play or quit by accident
+  if (t.depth > 1) {
+    t.depth -= 1;
+    t.selection = 0;
+  }
+}
 
 void setStyle(sf::Text &name, bool isSelected) {
   if (isSelected) {
@@ -82,60 +100,47 @@ void setStyle(sf::Text &name, bool isSelected) {
   }
 }
 
-void draw(T t, sf::RenderWindow &window) {
-  window.draw(t.background);
+void draw(T &t, Render::T &target) {
+  PROFILE_ZONE("Menu::draw");
+  Render::draw(target, t.background);
 
-  sf::Text name;
-  sf::Font font;
-
-  font.loadFromMemory(ARCADECLASSIC_TTF, ARCADECLASSIC_TTF_len);
+  const Page &current = page(t);
+  sf::Text &name = t.text;
 
   int pixels = WINDOW_HEIGHT / 12.f;
   int pwidth = WINDOW_WIDTH / 12.f;
   int lineHeight = pixels * 1.2f;
 
-  name.setFont(font); // font is a sf::Font
-  name.setString(t.name);
+  name.setFont(*t.font);
+  Render::setString(name, t.scratch, current.name);
   name.setCharacterSize(pixels); // in pixels, not points!
   name.setFillColor(sf::Color::Blue);
+  name.setStyle(sf::Text::Regular);
   name.setPosition(t.background.getPosition());
 
-  window.draw(name);
+  Render::draw(target, name);
 
-  for (int i = 0; i < t.items.size(); i++) {
-    auto item = t.items[i];
+  for (std::size_t i = 0; i < current.items.size(); i++) {
+    const Item &item = current.items[i];
     float offset = (i + 2) * lineHeight;
 
-    if (holds_alternative<Single_choice>(item)) {
-      auto choice = get<Single_choice>(item);
-      name.setString(choice.name);
-      setStyle(name, i == t.selection);
-      name.setPosition(t.background.getPosition() + sf::Vector2f(0.f, offset));
-      window.draw(name);
-    } else {
-      auto choice = get<Multiple_choice>(item);
-      name.setString(choice.name);
-      setStyle(name, i == t.selection);
-      name.setPosition(t.background.getPosition() + sf::Vector2f(0.f, offset));
-      window.draw(name);
-
-      sf::Vector2f option_offset =
-          sf::Vector2f((t.name.size() + 1) * pwidth, offset);
-
-      for (int j = 0; j < choice.choices.size(); ++j) {
-        string choiceValue = choice.choices[j];
-        name.setString(choiceValue);
-        setStyle(name, j == choice.selection);
-        name.setPosition(t.background.getPosition() + option_offset);
-        window.draw(name);
-        option_offset += sf::Vector2f((choiceValue.size() + 1) * pwidth, 0.f);
-      }
+    Render::setString(name, t.scratch, item.name);
+    setStyle(name, i == t.selection);
+    name.setPosition(t.background.getPosition() + sf::Vector2f(0.f, offset));
+    Render::draw(target, name);
+
+    sf::Vector2f option_offset =
+        sf::Vector2f((item.name.size() + 1) * pwidth, offset);
+
+    for (std::size_t j = 0; j < item.options.size(); ++j) {
+      std::string_view choiceValue = item.options[j].name;
+      Render::setString(name, t.scratch, choiceValue);
+      setStyle(name, j == t.settings[item.setting]);
+      name.setPosition(t.background.getPosition() + option_offset);
+      Render::draw(target, name);
+      option_offset += sf::Vector2f((choiceValue.size() + 1) * pwidth, 0.f);
     }
   }
-
-  // display background
-  // display name
-  // display each item line by line
 }
 
 } // namespace Menu
@@ -1,43 +1,111 @@
 #ifndef MENU_H
 #define MENU_H
 
+#include "render.h"
 #include <SFML/Graphics.hpp>
-#include <string>
-#include <vector>
-
-using namespace std;
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string_view>
 
 namespace Menu {
 
-struct Multiple_choice {
-  string name;
-  size_t selection;
-  vector<string> choices;
+enum Action {
+  PLAY,
+  RESUME,
+  RESTART,
+  RESTART_CONFIRMED,
+  OPEN_SETTINGS,
+  BACK,
+  QUIT,
+};
+
+enum Setting {
+  SPEED,
+  NUMBER_OF_SETTINGS,
+};
+
+struct Option {
+  std::string_view name;
+  float value;
+};
+
+// Items with options are multiple choices, changed with left and right
+struct Item {
+  std::string_view name;
+  Action action;
+  std::span<const Option> options = {};
+  Setting setting = SPEED;
 };
 
-struct Single_choice {
-  string name;
+struct Page {
+  std::string_view name;
+  std::span<const Item> items;
 };
 
-using Item = variant<Single_choice, Multiple_choice>;
+constexpr Option SPEEDS[] = {{"1", 2.f}, {"2", 4.f}, {"3", 6.f}};
+
+constexpr Item MAIN_ITEMS[] = {
+    {"Play", PLAY},
+    {"Speed", PLAY, SPEEDS, SPEED},
+    {"Quit", QUIT},
+};
+constexpr Item PAUSE_ITEMS[] = {
+    {"Resume", RESUME},
+    {"Restart", RESTART},
+    {"Settings", OPEN_SETTINGS},
+    {"Quit", QUIT},
+};
+constexpr Item SETTINGS_ITEMS[] = {
+    {"Speed", BACK, SPEEDS, SPEED},
+    {"Back", BACK},
+};
+constexpr Item CONFIRM_RESTART_ITEMS[] = {
+    {"No", BACK},
+    {"Yes", RESTART_CONFIRMED},
+};
+constexpr Item GAME_OVER_ITEMS[] = {
+    {"Play again", RESTART_CONFIRMED},
+    {"Quit", QUIT},
+};
+
+constexpr Page MAIN = {"Menu", MAIN_ITEMS};
+constexpr Page PAUSE = {"Pause", PAUSE_ITEMS};
+constexpr Page SETTINGS = {"Settings", SETTINGS_ITEMS};
+constexpr Page CONFIRM_RESTART = {"Lose progress", CONFIRM_RESTART_ITEMS};
+constexpr Page GAME_OVER = {"Game over", GAME_OVER_ITEMS};
+
+constexpr std::size_t MAX_DEPTH = 4;
 
 struct T {
-  string name;
-  size_t selection;
-  vector<Item> items;
-  function<void(Item choice, float speed)> handle_choice;
+  // Pages opened on top of each other, the last one is shown
+  std::array<const Page *, MAX_DEPTH> pages = {&MAIN};
+  std::size_t depth = 1;
+  std::size_t selection = 0;
+  std::array<std::size_t, NUMBER_OF_SETTINGS> settings = {};
+  std::function<void(Action action, float speed)> handle_choice;
   sf::RectangleShape background;
+  // Set once loaded, must be before the first draw
+  const sf::Font *font = nullptr;
+  // Reused for every name drawn, see Render::setString
+  sf::Text text;
+  sf::String scratch;
 };
 
-T init_main(function<void(Item choice, float speed)> handle_choice);
-float getSpeed(T t);
+T init(std::function<void(Action action, float speed)> handle_choice);
+float getSpeed(const T &t);
 
-T selectUp(T t);
-T selectDown(T t);
-T selectRight(T t);
-T selectLeft(T t);
-void choose(T t);
-void draw(T t, sf::RenderWindow &window);
+// Navigation happens in place and never allocates
+void open(T &t, const Page &page);
+void selectUp(T &t);
+void selectDown(T &t);
+void selectRight(T &t);
+void selectLeft(T &t);
+void choose(T &t);
+// Goes back to the previous page, does nothing on the root one
+void cancel(T &t);
+void draw(T &t, Render::T &target);
 
 } // namespace Menu
 
@@ -0,0 +1,180 @@
+#include "net.h"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace Net {
+
+constexpr std::size_t READ_SIZE = 4096;
+constexpr int BACKLOG = 1024;
+
+bool receive(Connection &t) {
+  while (true) {
+    std::size_t at = t.in.size();
+    t.in.resize(at + READ_SIZE);
+    ssize_t count = ::recv(t.fd, &t.in[at], READ_SIZE, 0);
+    t.in.resize(at + (count > 0 ? count : 0));
+    if (count > 0) {
+      continue;
+    }
+    if (count == 0) {
+      return false;
+    }
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+  }
+}
+
+bool flush(Connection &t) {
+  std::size_t sent = 0;
+  while (sent < t.out.size()) {
+    ssize_t count =
+        ::send(t.fd, &t.out[sent], t.out.size() - sent, MSG_NOSIGNAL);
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        return false;
+      }
+      break;
+    }
+    sent += count;
+  }
+  t.out.erase(t.out.begin(), t.out.begin() + sent);
+  return true;
+}
+
+void close(Connection &t) {
+  if (t.fd >= 0) {
+    ::close(t.fd);
+  }
+  t.fd = -1;
+  t.in.clear();
+  t.out.clear();
+}
+
+bool isUnix(const std::string &address) {
+  return address.find('/') != std::string::npos;
+}
+
+bool makeNonBlocking(int fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// Messages are small and sent once per step, do not wait to fill packets
+void setNoDelay(int fd, const std::string &address) {
+  if (!isUnix(address)) {
+    int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  }
+}
+
+// Fills `storage` with the address, returns its size or 0
+socklen_t resolve(const std::string &address, sockaddr_storage &storage) {
+  std::memset(&storage, 0, sizeof(storage));
+  if (isUnix(address)) {
+    auto *local = reinterpret_cast<sockaddr_un *>(&storage);
+    if (address.size() >= sizeof(local->sun_path)) {
+      return 0;
+    }
+    local->sun_family = AF_UNIX;
+    std::memcpy(local->sun_path, address.c_str(), address.size() + 1);
+    return sizeof(sockaddr_un);
+  }
+
+  // A port on the loopback, the whole address
+  std::uint16_t port = 0;
+  if (!parse(address, port) || port == 0) {
+    return 0;
+  }
+  auto *loopback = reinterpret_cast<sockaddr_in *>(&storage);
+  loopback->sin_family = AF_INET;
+  loopback->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  loopback->sin_port = htons(port);
+  return sizeof(sockaddr_in);
+}
+
+int open(const std::string &address, sockaddr_storage &storage,
+         socklen_t &size) {
+  size = resolve(address, storage);
+  if (size == 0) {
+    std::cerr << "Invalid address " << address << std::endl;
+    return -1;
+  }
+  int fd = ::socket(storage.ss_family, SOCK_STREAM, 0);
+  if (fd < 0) {
+    std::cerr << "socket: " << std::strerror(errno) << std::endl;
+  }
+  return fd;
+}
+
+int listen(const std::string &address) {
+  sockaddr_storage storage;
+  socklen_t size;
+  int fd = open(address, storage, size);
+  if (fd < 0) {
+    return -1;
+  }
+
+  if (isUnix(address)) {
+    // Left behind by a previous server
+    ::unlink(address.c_str());
+  } else {
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  }
+  if (::bind(fd, reinterpret_cast<sockaddr *>(&storage), size) != 0 ||
+      ::listen(fd, BACKLOG) != 0 || !makeNonBlocking(fd)) {
+    std::cerr << "Cannot listen on " << address << ": "
+              << std::strerror(errno) << std::endl;
+    ::close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+int connect(const std::string &address) {
+  sockaddr_storage storage;
+  socklen_t size;
+  int fd = open(address, storage, size);
+  if (fd < 0) {
+    return -1;
+  }
+
+  // Connected while blocking, local connections are immediate
+  if (::connect(fd, reinterpret_cast<sockaddr *>(&storage), size) != 0 ||
+      !makeNonBlocking(fd)) {
+    std::cerr << "Cannot connect to " << address << ": "
+              << std::strerror(errno) << std::endl;
+    ::close(fd);
+    return -1;
+  }
+  setNoDelay(fd, address);
+  return fd;
+}
+
+int accept(int listener) {
+  int fd = ::accept(listener, nullptr, nullptr);
+  if (fd < 0) {
+    return -1;
+  }
+  if (!makeNonBlocking(fd)) {
+    ::close(fd);
+    return -1;
+  }
+  // Both kinds of sockets take it, only TCP ones use it
+  int on = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  return fd;
+}
+
+} // namespace Net
@@ -0,0 +1,141 @@
+#ifndef NET_H
+#define NET_H
+
+#include "constants.h"
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Protocol of tetris_server, and the non-blocking sockets it runs on. Both
+// ends are on the same machine, over a Unix domain socket or the loopback,
+// so messages are in the byte order of the host.
+namespace Net {
+
+// A message is its type, the size of its payload in a byte, then the payload
+enum Type : std::uint8_t {
+  // From the clients
+  KEY = 1,
+  // From the server
+  WELCOME,
+  STATE,
+  BOARD,
+  END,
+};
+
+constexpr std::size_t HEADER = 2;
+
+// The keys of the game
+enum Key : std::uint8_t {
+  LEFT,
+  RIGHT,
+  DOWN,
+  UP,
+  SPACE,
+  Z,
+  KEYS,
+};
+
+struct KeyMessage {
+  std::uint8_t key;
+  std::uint8_t pressed;
+};
+
+// Once the match starts
+struct Welcome {
+  std::uint32_t seed;
+  std::uint8_t player;
+  // Worker threads of the server, for the load generator
+  std::uint8_t workers;
+};
+
+// After every step of the match, of the player receiving it
+struct State {
+  std::uint32_t tick;
+  std::int32_t score;
+  std::uint16_t lines;
+  std::int8_t x;
+  std::int8_t y;
+  std::uint8_t orientation;
+  std::uint8_t type;
+  std::uint8_t garbage;
+  std::uint8_t opponentGarbage;
+};
+static_assert(sizeof(State) == 16, "no padding on the wire");
+
+// Occupancy of the grid, after a piece locked or garbage came up
+struct Board {
+  std::uint16_t rows[NUMROWS];
+};
+
+struct End {
+  std::uint8_t won;
+};
+
+// A socket with what is left to read from it and to send to it
+struct Connection {
+  int fd = -1;
+  std::vector<char> in;
+  std::vector<char> out;
+};
+
+// `payload` is trivially copyable
+template <typename M> void append(Connection &t, Type type, const M &payload) {
+  static_assert(sizeof(M) < 256, "the size of a payload is a byte");
+  std::size_t at = t.out.size();
+  t.out.resize(at + HEADER + sizeof(M));
+  t.out[at] = char(type);
+  t.out[at + 1] = char(sizeof(M));
+  std::memcpy(&t.out[at + HEADER], &payload, sizeof(M));
+}
+
+template <typename M> M read(const char *payload) {
+  M message;
+  std::memcpy(&message, payload, sizeof(M));
+  return message;
+}
+
+// Calls handle(type, payload, size) for each complete message received and
+// drops them, a partial message stays for the next time
+template <typename Handle> void consume(Connection &t, Handle handle) {
+  std::size_t at = 0;
+  while (t.in.size() - at >= HEADER) {
+    std::size_t size = std::uint8_t(t.in[at + 1]);
+    if (t.in.size() - at < HEADER + size) {
+      break;
+    }
+    handle(Type(t.in[at]), &t.in[at + HEADER], size);
+    at += HEADER + size;
+  }
+  t.in.erase(t.in.begin(), t.in.begin() + at);
+}
+
+// For the ports and the options of the tools, the whole of `text` must be
+// the number
+template <typename Number> bool parse(const std::string &text, Number &value) {
+  const char *end = text.data() + text.size();
+  auto [parsed, error] = std::from_chars(text.data(), end, value);
+  return error == std::errc() && parsed == end;
+}
+
+// Reads what is available, false when the peer closed or on error
+bool receive(Connection &t);
+
+// Sends what the socket takes, false on error
+bool flush(Connection &t);
+
+void close(Connection &t);
+
+// A path with a slash is a Unix domain socket, otherwise a port on the
+// loopback. Both return a non-blocking socket, -1 on error.
+int listen(const std::string &address);
+int connect(const std::string &address);
+
+// Returns -1 when there is nothing to accept
+int accept(int listener);
+
+} // namespace Net
+
+#endif // !NET_H
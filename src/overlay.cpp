@@ -0,0 +1,76 @@
+#include "overlay.h"
+#include "alloc.h"
+#include "constants.h"
+#include "profile.h"
+#include "render.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+
+namespace Overlay {
+
+constexpr std::size_t LINE_SIZE = 256;
+
+// Formatted on the stack
+std::string_view format(char (&line)[LINE_SIZE], int fps,
+                        const Render::Stats &stats, std::size_t arenaHighWater,
+                        sf::Time droppedTime, int steps,
+                        Alloc::Counters allocations,
+                        Alloc::Counters stepAllocations) {
+  int size = std::snprintf(
+      line, LINE_SIZE,
+      "FPS %d   DRAWS %zu   VERTICES %zu   STATES %zu   TEXTURES %zu   "
+      "ARENA KB %zu OF %zu   DROPPED MS %d   STEPS %d   ALLOCS %llu   "
+      "BYTES %llu   IN STEPS %llu",
+      fps, stats.drawCalls, stats.vertices, stats.stateChanges,
+      stats.textureBinds, stats.arenaBytes / 1024, arenaHighWater / 1024,
+      int(droppedTime.asMilliseconds()), steps,
+      (unsigned long long)allocations.allocations,
+      (unsigned long long)allocations.bytes,
+      (unsigned long long)stepAllocations.allocations);
+  return std::string_view(line, std::min<std::size_t>(size, LINE_SIZE - 1));
+}
+
+void init(T &t, const sf::Font &font) {
+  t.text.setFont(font);
+  t.text.setCharacterSize(SQUARESIZE / 3.f);
+  t.text.setFillColor(sf::Color::White);
+  t.text.setPosition(4.f, 4.f);
+
+  // Every character and more than the length of any line
+  char line[LINE_SIZE];
+  std::size_t large = 1234567890;
+  Render::Stats stats = {large, large, large, large, large * 1024};
+  Alloc::Counters counters = {large, large};
+  Render::primeText(t.text, t.scratch,
+                    format(line, int(large), stats, large * 1024,
+                           sf::seconds(1234567.f), int(large), counters,
+                           counters));
+}
+
+void toggle(T &t) { t.visible = !t.visible; }
+
+void draw(T &t, Render::T &target, sf::Time droppedTime, int steps,
+          Alloc::Counters allocations, Alloc::Counters stepAllocations) {
+  PROFILE_ZONE("Overlay::draw");
+  // Smoothed so the numbers stay readable
+  float elapsed = t.clock.restart().asSeconds();
+  t.frameTime = t.frameTime * 0.9f + elapsed * 0.1f;
+
+  if (!t.visible) {
+    return;
+  }
+
+  const Render::Stats &stats = target.last;
+  int fps = t.frameTime > 0.f ? int(1.f / t.frameTime) : 0;
+
+  char line[LINE_SIZE];
+  Render::setString(t.text, t.scratch,
+                    format(line, fps, stats, target.arena.highWater,
+                           droppedTime, steps, allocations, stepAllocations));
+  Render::draw(target, t.text);
+}
+
+} // namespace Overlay
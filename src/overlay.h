@@ -0,0 +1,32 @@
+#ifndef OVERLAY_H
+#define OVERLAY_H
+
+#include "alloc.h"
+#include "render.h"
+#include <SFML/Graphics.hpp>
+
+namespace Overlay {
+
+// Frame statistics drawn on top of everything, toggled with F3
+struct T {
+  bool visible = false;
+  sf::Text text;
+  sf::Clock clock;
+  float frameTime = 0.0f;
+  // Reused to set the text, the overlay must not allocate what it shows
+  sf::String scratch;
+};
+
+// The text keeps a pointer to the font, keep it alive
+void init(T &t, const sf::Font &font);
+
+void toggle(T &t);
+
+// `allocations` are those of the last frame, `stepAllocations` those of the
+// fixed steps of this one
+void draw(T &t, Render::T &target, sf::Time droppedTime, int steps,
+          Alloc::Counters allocations, Alloc::Counters stepAllocations);
+
+} // namespace Overlay
+
+#endif // !OVERLAY_H
@@ -0,0 +1,152 @@
+#include "particles.h"
+#include "constants.h"
+#include "profile.h"
+#include "render.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <random>
+
+namespace Particles {
+
+constexpr float GRAVITY = 30.f * SQUARESIZE;
+
+T init() {
+  T t = T{};
+  t.x.resize(CAPACITY);
+  t.y.resize(CAPACITY);
+  t.vx.resize(CAPACITY);
+  t.vy.resize(CAPACITY);
+  t.life.resize(CAPACITY);
+  t.maxLife.resize(CAPACITY);
+  t.color.resize(CAPACITY);
+  return t;
+}
+
+void emit(T &t, sf::Vector2f position, sf::Vector2f velocity, float life,
+          sf::Color color) {
+  if (t.count == CAPACITY) {
+    return;
+  }
+  std::size_t i = t.count++;
+  t.x[i] = position.x;
+  t.y[i] = position.y;
+  t.vx[i] = velocity.x;
+  t.vy[i] = velocity.y;
+  t.life[i] = life;
+  t.maxLife[i] = life;
+  t.color[i] = color;
+}
+
+void update(T &t, float elapsed) {
+  PROFILE_ZONE("Particles::update");
+  for (std::size_t i = 0; i < t.count; ++i) {
+    t.vy[i] += GRAVITY * elapsed;
+    t.x[i] += t.vx[i] * elapsed;
+    t.y[i] += t.vy[i] * elapsed;
+    t.life[i] -= elapsed;
+  }
+
+  // Swap the dead with the last alive particles
+  std::size_t i = 0;
+  while (i < t.count) {
+    if (t.life[i] > 0.f) {
+      ++i;
+      continue;
+    }
+    std::size_t last = --t.count;
+    t.x[i] = t.x[last];
+    t.y[i] = t.y[last];
+    t.vx[i] = t.vx[last];
+    t.vy[i] = t.vy[last];
+    t.life[i] = t.life[last];
+    t.maxLife[i] = t.maxLife[last];
+    t.color[i] = t.color[last];
+  }
+}
+
+void draw(const T &t, Render::T &target) {
+  PROFILE_ZONE("Particles::draw");
+  if (t.count == 0) {
+    return;
+  }
+  sf::Vertex *vertices = Render::vertices(target, t.count * 4);
+  for (std::size_t i = 0; i < t.count; ++i) {
+    sf::Color color = t.color[i];
+    color.a = std::uint8_t(color.a * (t.life[i] / t.maxLife[i]));
+
+    sf::Vertex *quad = &vertices[i * 4];
+    quad[0] = sf::Vertex(sf::Vector2f(t.x[i], t.y[i]), color);
+    quad[1] = sf::Vertex(sf::Vector2f(t.x[i] + PARTICLE_SIZE, t.y[i]), color);
+    quad[2] = sf::Vertex(
+        sf::Vector2f(t.x[i] + PARTICLE_SIZE, t.y[i] + PARTICLE_SIZE), color);
+    quad[3] = sf::Vertex(sf::Vector2f(t.x[i], t.y[i] + PARTICLE_SIZE), color);
+  }
+  Render::draw(target, vertices, t.count * 4, sf::Quads);
+}
+
+float random(T &t, float min, float max) {
+  std::uniform_real_distribution<float> distribution(min, max);
+  return distribution(t.gen);
+}
+
+void burst(T &t, sf::Vector2f position, int count, float speed, float life,
+           sf::Color color) {
+  for (int i = 0; i < count; ++i) {
+    sf::Vector2f velocity(random(t, -speed, speed), random(t, -speed, 0.f));
+    sf::Vector2f offset(random(t, 0.f, SQUARESIZE),
+                        random(t, 0.f, SQUARESIZE));
+    emit(t, position + offset, velocity, random(t, life / 2.f, life), color);
+  }
+}
+
+void lineClear(T &t, int row) {
+  float y = (row + OFFSET_GRID) * SQUARESIZE;
+  for (int col = 0; col < NUMCOLS; ++col) {
+    float x = (col + OFFSET_GRID) * SQUARESIZE;
+    burst(t, sf::Vector2f(x, y), 16, 8.f * SQUARESIZE, 0.8f,
+          sf::Color::White);
+  }
+}
+
+// Top left corner in pixels of a cell of the grid
+sf::Vector2f corner(sf::Vector2i cell) {
+  return GRID_ORIGIN + sf::Vector2f(cell) * SQUARESIZE;
+}
+
+void lock(T &t, const State::Events &events) {
+  for (const auto &cell : events.lockedBlocks) {
+    burst(t, corner(cell) + sf::Vector2f(0.f, SQUARESIZE * .8f), 4,
+          SQUARESIZE, 0.25f, events.lockedColor);
+  }
+}
+
+void hardDrop(T &t, const State::Events &events) {
+  // A trail above the piece, as long as the distance it fell
+  float length = events.hardDropDistance * SQUARESIZE;
+  for (const auto &cell : events.lockedBlocks) {
+    sf::Vector2f block = corner(cell);
+    for (int i = 0; i < 2 * events.hardDropDistance; ++i) {
+      sf::Vector2f position(block.x + random(t, 0.f, SQUARESIZE),
+                            block.y - random(t, 0.f, length));
+      emit(t, position, sf::Vector2f(0.f, -SQUARESIZE), random(t, .1f, .3f),
+           events.lockedColor);
+    }
+  }
+}
+
+void trigger(T &t, const State::Events &events) {
+  if (events.hardDropped) {
+    hardDrop(t, events);
+  }
+  if (events.locked) {
+    lock(t, events);
+  }
+  for (int row = 0; row < NUMROWS; ++row) {
+    if (events.clearedRows & (Board::Rows(1) << row)) {
+      lineClear(t, row);
+    }
+  }
+}
+
+} // namespace Particles
@@ -0,0 +1,49 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include "render.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace Particles {
+
+constexpr std::size_t CAPACITY = 16384;
+constexpr float PARTICLE_SIZE = SQUARESIZE / 10.f;
+
+// Structure of arrays, allocated once by init. Emitting past the capacity
+// drops the new particles.
+struct T {
+  std::size_t count = 0;
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> vx;
+  std::vector<float> vy;
+  std::vector<float> life;
+  std::vector<float> maxLife;
+  std::vector<sf::Color> color;
+  std::minstd_rand gen;
+};
+
+T init();
+
+void emit(T &t, sf::Vector2f position, sf::Vector2f velocity, float life,
+          sf::Color color);
+
+void update(T &t, float elapsed);
+
+void draw(const T &t, Render::T &target);
+
+// Effects
+void lineClear(T &t, int row);
+void lock(T &t, const State::Events &events);
+void hardDrop(T &t, const State::Events &events);
+
+// Spawns the effects of everything that happened since the last call
+void trigger(T &t, const State::Events &events);
+
+} // namespace Particles
+
+#endif // !PARTICLES_H
@@ -1,30 +1,193 @@
 #ifndef PIECE_H
 #define PIECE_H
 
+#include "render.h"
 #include <SFML/Graphics.hpp>
-#include <random>
+#include <array>
+#include <cstdint>
 
 namespace Piece {
+
+constexpr size_t QUEUE_SIZE = 5;
+// Type of the cells pushed up by the lines of an opponent, after the pieces
+constexpr int GARBAGE = 8;
+// Blocks are drawn that much larger than a cell on every side
+constexpr float OUTLINE = 0.5f;
+
+// Column and row of each block, 0 is the top left cell of the board
+using Cells = std::array<sf::Vector2i, 4>;
+
+// Super Rotation System. The pieces turn in a box of 3 by 3 cells, 4 by 4
+// for the line, whose cell (1, 1) is the position of the piece. A turned
+// piece that does not fit is tried at each of its kicks in turn, the first
+// that fits wins. Orientations go from 1 to 4, 1 is the spawn orientation.
+struct Offset {
+  int x;
+  int y;
+};
+using Shape = std::array<Offset, 4>;
+constexpr int KICK_TESTS = 5;
+using Kicks = std::array<Offset, KICK_TESTS>;
+
+constexpr int TYPES = 7;
+
+// From the spawn orientation, 0 the top left cell of the box
+constexpr std::array<Shape, TYPES> SPAWN_SHAPES = {{
+    {{{0, 1}, {1, 1}, {2, 1}, {3, 1}}}, // I
+    {{{1, 0}, {2, 0}, {1, 1}, {2, 1}}}, // O
+    {{{0, 0}, {0, 1}, {1, 1}, {2, 1}}}, // J
+    {{{2, 0}, {0, 1}, {1, 1}, {2, 1}}}, // L
+    {{{1, 0}, {2, 0}, {0, 1}, {1, 1}}}, // S
+    {{{1, 0}, {0, 1}, {1, 1}, {2, 1}}}, // T
+    {{{0, 0}, {1, 0}, {1, 1}, {2, 1}}}, // Z
+}};
+
+// Offsets from the position, by type - 1 and orientation - 1. Each
+// orientation is the previous one turned clockwise in its box, but the
+// square's, which stays in place.
+constexpr std::array<std::array<Shape, 4>, TYPES> SHAPES = [] {
+  std::array<std::array<Shape, 4>, TYPES> shapes = {};
+  for (int type = 0; type < TYPES; ++type) {
+    Shape box = SPAWN_SHAPES[type];
+    int last = type == 0 ? 3 : 2;
+    for (int orientation = 0; orientation < 4; ++orientation) {
+      for (int i = 0; i < 4; ++i) {
+        shapes[type][orientation][i] = {box[i].x - 1, box[i].y - 1};
+      }
+      for (Offset &cell : box) {
+        cell = type == 1 ? cell : Offset{last - cell.y, cell.x};
+      }
+    }
+  }
+  return shapes;
+}();
+
+// By orientation - 1, then clockwise and counter-clockwise, as published
+// with y going up: 0->R, 0->L, R->2, R->0, 2->L, 2->R, L->0, L->2
+constexpr std::array<Kicks, 8> PUBLISHED_KICKS = {{
+    {{{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}}},
+    {{{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}}},
+    {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},
+    {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},
+    {{{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}}},
+    {{{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}}},
+    {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}},
+    {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}},
+}};
+// The line has its own
+constexpr std::array<Kicks, 8> PUBLISHED_LINE_KICKS = {{
+    {{{0, 0}, {-2, 0}, {1, 0}, {-2, -1}, {1, 2}}},
+    {{{0, 0}, {-1, 0}, {2, 0}, {-1, 2}, {2, -1}}},
+    {{{0, 0}, {-1, 0}, {2, 0}, {-1, 2}, {2, -1}}},
+    {{{0, 0}, {2, 0}, {-1, 0}, {2, 1}, {-1, -2}}},
+    {{{0, 0}, {2, 0}, {-1, 0}, {2, 1}, {-1, -2}}},
+    {{{0, 0}, {1, 0}, {-2, 0}, {1, -2}, {-2, 1}}},
+    {{{0, 0}, {1, 0}, {-2, 0}, {1, -2}, {-2, 1}}},
+    {{{0, 0}, {-2, 0}, {1, 0}, {-2, -1}, {1, 2}}},
+}};
+
+// On the board, y goes down
+constexpr std::array<Kicks, 8> flip(std::array<Kicks, 8> kicks) {
+  for (Kicks &tests : kicks) {
+    for (Offset &kick : tests) {
+      kick.y = -kick.y;
+    }
+  }
+  return kicks;
+}
+constexpr std::array<Kicks, 8> KICKS = flip(PUBLISHED_KICKS);
+constexpr std::array<Kicks, 8> LINE_KICKS = flip(PUBLISHED_LINE_KICKS);
+// The square does not need any
+constexpr Kicks NO_KICKS = {};
+
+// Rows of a shape as bit masks, for the tests against the rows of a board:
+// bit 0 of the first row is the cell (left, top) from the position
+struct Footprint {
+  int left;
+  int top;
+  int width;
+  int height;
+  std::array<std::uint8_t, 4> rows;
+};
+
+constexpr std::array<std::array<Footprint, 4>, TYPES> FOOTPRINTS = [] {
+  std::array<std::array<Footprint, 4>, TYPES> footprints = {};
+  for (int type = 0; type < TYPES; ++type) {
+    for (int orientation = 0; orientation < 4; ++orientation) {
+      const Shape &shape = SHAPES[type][orientation];
+      Footprint footprint = {shape[0].x, shape[0].y, 0, 0, {}};
+      int right = shape[0].x;
+      int bottom = shape[0].y;
+      for (Offset cell : shape) {
+        footprint.left = cell.x < footprint.left ? cell.x : footprint.left;
+        footprint.top = cell.y < footprint.top ? cell.y : footprint.top;
+        right = cell.x > right ? cell.x : right;
+        bottom = cell.y > bottom ? cell.y : bottom;
+      }
+      footprint.width = right - footprint.left + 1;
+      footprint.height = bottom - footprint.top + 1;
+      for (Offset cell : shape) {
+        footprint.rows[cell.y - footprint.top] |=
+            std::uint8_t(1 << (cell.x - footprint.left));
+      }
+      footprints[type][orientation] = footprint;
+    }
+  }
+  return footprints;
+}();
+
+// `orientation` turned by `offset`, 1 clockwise and -1 counter-clockwise
+constexpr int turn(int orientation, int offset) {
+  return 1 + (orientation - 1 + 4 + offset) % 4;
+}
+
+// Of a piece of a valid type
+constexpr const Footprint &footprint(int type, int orientation) {
+  return FOOTPRINTS[type - 1][orientation - 1];
+}
+
+// Tried when turning from `orientation` by `offset`
+constexpr const Kicks &kicks(int type, int orientation, int offset) {
+  int index = (orientation - 1) * 2 + (offset < 0 ? 1 : 0);
+  return type == 1 ? LINE_KICKS[index] : type == 2 ? NO_KICKS : KICKS[index];
+}
+
+// Generator of the queue, small enough for the state to be copied every
+// step. Never zero, which it would keep.
+constexpr std::uint32_t xorshift(std::uint32_t &state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+constexpr int randomType(std::uint32_t &state) {
+  return 1 + int(xorshift(state) % TYPES);
+}
+
 struct T {
   int orientation;
   int type;
-  sf::Vector2f origin;
-  sf::Vector2f position;
-  std::vector<sf::RectangleShape> blocks;
-  std::mt19937 gen;                                // Seed the generator
-  std::uniform_int_distribution<int> distribution; // Define the range
+  sf::Vector2i position;
+  Cells blocks;
+  std::uint32_t random;             // State of the generator
+  std::array<int, QUEUE_SIZE> next; // Upcoming types
 };
 
 sf::Color color(int type);
 
-std::vector<sf::RectangleShape>
-blocks(int type, int rotation, sf::Vector2f origin, sf::Vector2f position);
-T set(T t, int orientation, int type, sf::Vector2f position);
-T reset(T t);
-T copyWithOffset(const T &t, sf::Vector2f offset);
-T copyWithRotation(const T &t, int offset);
-T init(sf::Vector2f origin);
-void draw(T t, sf::RenderWindow &window);
+Cells blocks(int type, int rotation, sf::Vector2i position);
+T set(T t, int orientation, int type, sf::Vector2i position);
+// Where pieces appear on a board `columns` wide: their box in the top rows,
+// in the middle or one column to the left of it
+sf::Vector2i spawn(int columns);
+// The next piece of the queue, at the top of a board `columns` wide
+T reset(T t, int columns);
+T copyWithOffset(const T &t, sf::Vector2i offset);
+T init(unsigned int seed);
+// `origin` is the top left corner of the board and `size` the side of a cell,
+// in pixels
+void draw(const T &t, Render::T &target, sf::Vector2f origin, float size);
 
 } // namespace Piece
 
@@ -0,0 +1,379 @@
+#include "pool.h"
+#include "constants.h"
+#include "piece.h"
+#include "profile.h"
+#include "render.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Pool {
+
+// Pieces spawn at the top, like Piece::reset
+const int SPAWN_X = Piece::spawn(NUMCOLS).x;
+const int SPAWN_Y = Piece::spawn(NUMCOLS).y;
+
+Row at(Row mask, int x) { return (mask << (x + GUTTER)) >> GUTTER; }
+
+std::uint8_t nextType(T &t, int board) {
+  return std::uint8_t(Piece::randomType(t.random[board]));
+}
+
+std::uint16_t fallInterval(int lines) {
+  float rowsPerSecond =
+      1.f + State::SPEED_PER_LEVEL * (lines / State::LINES_PER_LEVEL);
+  return std::uint16_t(std::lround(fixedNumberOfFrames / rowsPerSecond));
+}
+
+const Row *rows(const T &t, int board) { return &t.rows[board * STRIDE]; }
+
+const Shape &shape(const T &t, int type, int orientation) {
+  return t.shapes[(type - 1) * 4 + orientation];
+}
+
+bool collides(const Row *rows, const Shape &shape, int x, int y) {
+  // The rows of the board start GUTTER above the grid
+  rows += y + SHAPE_TOP + GUTTER;
+  Row hit = 0;
+  for (int i = 0; i < SHAPE_ROWS; ++i) {
+    hit |= rows[i] & at(shape[i], x);
+  }
+  return hit != 0;
+}
+
+bool collides(const T &t, int board, int orientation, int x, int y) {
+  return collides(rows(t, board), shape(t, t.type[board], orientation), x, y);
+}
+
+bool turn(const T &t, int board, int offset, int &orientation, int &x,
+          int &y) {
+  int type = t.type[board];
+  int turned = (orientation + 4 + offset) & 3;
+  const Shape &turnedShape = shape(t, type, turned);
+  for (Piece::Offset kick : Piece::kicks(type, orientation + 1, offset)) {
+    int kickedX = x + kick.x;
+    int kickedY = y + kick.y;
+    // Past the wall or the floor nothing fits anyway
+    if (kickedX < -GUTTER || kickedY < -SHAPE_TOP - GUTTER ||
+        kickedY > NUMROWS) {
+      continue;
+    }
+    if (!collides(rows(t, board), turnedShape, kickedX, kickedY)) {
+      orientation = turned;
+      x = kickedX;
+      y = kickedY;
+      return true;
+    }
+  }
+  return false;
+}
+
+void spawn(T &t, int board) {
+  t.type[board] = t.next[board];
+  t.next[board] = nextType(t, board);
+  t.x[board] = SPAWN_X;
+  t.y[board] = SPAWN_Y;
+  t.orientation[board] = 0;
+  t.sinceFall[board] = 0;
+  if (collides(t, board, 0, SPAWN_X, SPAWN_Y)) {
+    t.lost[board] = 1;
+  }
+}
+
+T init(int count, unsigned int seed) {
+  T t = T{};
+  t.count = count;
+  t.seed = seed;
+  for (int type = 1; type <= TYPES; ++type) {
+    for (int orientation = 0; orientation < 4; ++orientation) {
+      Shape &shape = t.shapes[(type - 1) * 4 + orientation];
+      shape = {};
+      for (auto cell : Piece::blocks(type, orientation + 1, {0, 0})) {
+        shape[cell.y - SHAPE_TOP] |= Row(1) << (cell.x + GUTTER);
+      }
+    }
+  }
+
+  std::size_t n = count;
+  t.rows.resize(n * STRIDE);
+  t.cells.resize(n * NUMROWS * NUMCOLS);
+  t.x.resize(n);
+  t.y.resize(n);
+  t.orientation.resize(n);
+  t.type.resize(n);
+  t.next.resize(n);
+  t.random.resize(n);
+  t.sinceFall.resize(n);
+  t.fallInterval.resize(n);
+  t.score.resize(n);
+  t.lines.resize(n);
+  t.pieces.resize(n);
+  t.garbage.resize(n);
+  t.lost.resize(n);
+  t.input.resize(n);
+  t.locked.resize(n);
+  t.cleared.resize(n);
+  t.piece.resize(n * SHAPE_ROWS);
+  t.around.resize(n * (SHAPE_ROWS + 1));
+  for (int board = 0; board < count; ++board) {
+    // Distinct and never zero, which xorshift would keep
+    t.random[board] = (seed + board) * 2654435761u | 1u;
+    restart(t, board);
+  }
+  return t;
+}
+
+void restart(T &t, int board) {
+  Row *rows = &t.rows[board * STRIDE];
+  std::fill(rows, rows + GUTTER + NUMROWS, EMPTY_ROW);
+  std::fill(rows + GUTTER + NUMROWS, rows + STRIDE, FULL_ROW);
+  auto cells = t.cells.begin() + board * NUMROWS * NUMCOLS;
+  std::fill(cells, cells + NUMROWS * NUMCOLS, 0);
+
+  t.score[board] = 0;
+  t.lines[board] = 0;
+  t.pieces[board] = 0;
+  t.garbage[board] = 0;
+  t.lost[board] = 0;
+  t.fallInterval[board] = fallInterval(0);
+  t.next[board] = nextType(t, board);
+  spawn(t, board);
+}
+
+// The rows above each full row fall into its place, returns how many
+int removeFullRows(T &t, int board) {
+  Row *rows = &t.rows[board * STRIDE + GUTTER];
+  std::uint8_t *cells = &t.cells[board * NUMROWS * NUMCOLS];
+  int to = NUMROWS - 1;
+  for (int from = NUMROWS - 1; from >= 0; --from) {
+    if (rows[from] == FULL_ROW) {
+      continue;
+    }
+    if (to != from) {
+      rows[to] = rows[from];
+      std::copy_n(cells + from * NUMCOLS, NUMCOLS, cells + to * NUMCOLS);
+    }
+    to -= 1;
+  }
+  int removed = to + 1;
+  for (; to >= 0; --to) {
+    rows[to] = EMPTY_ROW;
+    std::fill_n(cells + to * NUMCOLS, NUMCOLS, 0);
+  }
+  return removed;
+}
+
+// Pushes the stack up, the garbage rows have a hole in the same column
+void addGarbage(T &t, int board) {
+  int count = std::min<int>(t.garbage[board], NUMROWS);
+  t.garbage[board] = 0;
+  Row *rows = &t.rows[board * STRIDE + GUTTER];
+  std::uint8_t *cells = &t.cells[board * NUMROWS * NUMCOLS];
+  std::copy(rows + count, rows + NUMROWS, rows);
+  std::copy(cells + count * NUMCOLS, cells + NUMROWS * NUMCOLS, cells);
+
+  int hole = Piece::xorshift(t.random[board]) % NUMCOLS;
+  for (int row = NUMROWS - count; row < NUMROWS; ++row) {
+    rows[row] = FULL_ROW & ~(Row(1) << (hole + GUTTER));
+    std::fill_n(cells + row * NUMCOLS, NUMCOLS, Piece::GARBAGE);
+    cells[row * NUMCOLS + hole] = 0;
+  }
+}
+
+void lock(T &t, int board) {
+  if (t.input[board] & HARD_DROP) {
+    int distance = 0;
+    while (!collides(t, board, t.orientation[board], t.x[board],
+                     t.y[board] + distance + 1)) {
+      distance += 1;
+    }
+    t.y[board] += distance;
+    t.score[board] += State::HARD_DROP_SCORE * distance;
+  }
+
+  const Shape &cells = shape(t, t.type[board], t.orientation[board]);
+  for (int i = 0; i < SHAPE_ROWS; ++i) {
+    int row = t.y[board] + SHAPE_TOP + i;
+    Row mask = at(cells[i], t.x[board]);
+    if (mask == 0 || row < 0) {
+      continue;
+    }
+    t.rows[board * STRIDE + GUTTER + row] |= mask;
+    for (int col = 0; col < NUMCOLS; ++col) {
+      if (mask & (Row(1) << (col + GUTTER))) {
+        t.cells[(board * NUMROWS + row) * NUMCOLS + col] = t.type[board];
+      }
+    }
+  }
+
+  int cleared = removeFullRows(t, board);
+  t.cleared[board] = std::uint8_t(cleared);
+  t.locked[board] = 1;
+  t.pieces[board] += 1;
+  // At the level of the lines before these, like State
+  t.score[board] += State::LINE_SCORES[std::min(cleared, 4)] *
+                    (1 + t.lines[board] / State::LINES_PER_LEVEL);
+  t.lines[board] += cleared;
+  t.fallInterval[board] = fallInterval(t.lines[board]);
+  if (t.garbage[board] > 0) {
+    addGarbage(t, board);
+  }
+  spawn(t, board);
+}
+
+// The passes of step over all the boards, `n` of them. The arrays are
+// restrict parameters and the conditions bitwise, so that they vectorise.
+void clearStep(int n, std::uint8_t *__restrict input,
+               const std::uint8_t *__restrict lost,
+               std::uint8_t *__restrict locked,
+               std::uint8_t *__restrict cleared) {
+  for (int b = 0; b < n; ++b) {
+    locked[b] = 0;
+    cleared[b] = 0;
+    input[b] = lost[b] ? 0 : input[b];
+  }
+}
+
+// A column to the right is a bit higher
+void move(int n, const std::uint8_t *__restrict input,
+          std::int8_t *__restrict x, Row *__restrict piece,
+          const Row *__restrict around) {
+  for (int b = 0; b < n; ++b) {
+    // 1 when asked, a move both ways is none
+    Row right = Row(input[b] / RIGHT & 1);
+    Row left = Row(input[b] / LEFT & 1);
+    Row toRight = Row(0) - (right & (left ^ 1));
+    Row toLeft = Row(0) - (left & (right ^ 1));
+    Row hit = 0;
+    for (int i = 0; i < SHAPE_ROWS; ++i) {
+      Row row = piece[i * n + b];
+      Row moved = (row << 1 & toRight) | (row >> 1 & toLeft) |
+                  (row & ~(toRight | toLeft));
+      hit |= around[i * n + b] & moved;
+    }
+    Row free = Row(0) - Row(hit == 0);
+    toRight &= free;
+    toLeft &= free;
+    x[b] = std::int8_t(x[b] + int(toRight & 1) - int(toLeft & 1));
+    for (int i = 0; i < SHAPE_ROWS; ++i) {
+      Row row = piece[i * n + b];
+      piece[i * n + b] = (row << 1 & toRight) | (row >> 1 & toLeft) |
+                         (row & ~(toRight | toLeft));
+    }
+  }
+}
+
+// The piece locks when it cannot fall when it should, so the lock delay is
+// the fall interval like in State
+void fall(int n, const std::uint8_t *__restrict input,
+          const std::uint8_t *__restrict lost, std::int8_t *__restrict y,
+          std::uint16_t *__restrict sinceFall,
+          const std::uint16_t *__restrict fallInterval,
+          std::int32_t *__restrict score, std::uint8_t *__restrict locked,
+          const Row *__restrict piece, const Row *__restrict around) {
+  for (int b = 0; b < n; ++b) {
+    bool soft = input[b] & SOFT_DROP;
+    int since = sinceFall[b] + 1 + soft * (SOFT_DROP_FACTOR - 1);
+    bool due = !lost[b] & (since >= fallInterval[b]);
+    Row hit = 0;
+    for (int i = 0; i < SHAPE_ROWS; ++i) {
+      hit |= around[(i + 1) * n + b] & piece[i * n + b];
+    }
+    bool blocked = hit != 0;
+    bool falls = due & !blocked;
+    y[b] = std::int8_t(y[b] + falls);
+    score[b] += (falls & soft) * State::SOFT_DROP_SCORE;
+    sinceFall[b] = std::uint16_t(since * !due);
+    locked[b] = (due & blocked) | ((input[b] & HARD_DROP) != 0);
+  }
+}
+
+void step(T &t) {
+  PROFILE_ZONE("Pool::step");
+  const int n = t.count;
+
+  // Only the boards turning or locking a piece are handled one by one
+  clearStep(n, t.input.data(), t.lost.data(), t.locked.data(),
+            t.cleared.data());
+
+  for (int b = 0; b < n; ++b) {
+    int offset = ((t.input[b] & ROTATE) != 0) -
+                 ((t.input[b] & COUNTER_ROTATE) != 0);
+    int orientation = t.orientation[b];
+    int x = t.x[b];
+    int y = t.y[b];
+    if (offset != 0 && turn(t, b, offset, orientation, x, y)) {
+      t.orientation[b] = std::uint8_t(orientation);
+      t.x[b] = std::int8_t(x);
+      t.y[b] = std::int8_t(y);
+    }
+  }
+
+  // The piece where it is now, and the rows it is tested against
+  for (int b = 0; b < n; ++b) {
+    const Shape &cells = shape(t, t.type[b], t.orientation[b]);
+    const Row *rows = &t.rows[b * STRIDE + t.y[b] + SHAPE_TOP + GUTTER];
+    for (int i = 0; i < SHAPE_ROWS; ++i) {
+      t.piece[i * n + b] = at(cells[i], t.x[b]);
+    }
+    for (int i = 0; i <= SHAPE_ROWS; ++i) {
+      t.around[i * n + b] = rows[i];
+    }
+  }
+
+  move(n, t.input.data(), t.x.data(), t.piece.data(), t.around.data());
+  fall(n, t.input.data(), t.lost.data(), t.y.data(), t.sinceFall.data(),
+       t.fallInterval.data(), t.score.data(), t.locked.data(), t.piece.data(),
+       t.around.data());
+
+  for (int b = 0; b < n; ++b) {
+    if (t.locked[b]) {
+      lock(t, b);
+    }
+    t.input[b] = 0;
+  }
+}
+
+void draw(const T &t, int board, Render::T &target, sf::Vector2f origin,
+          float size) {
+  PROFILE_ZONE("Pool::draw");
+  const std::uint8_t *cells = &t.cells[board * NUMROWS * NUMCOLS];
+  std::size_t blocks = 4;
+  for (int i = 0; i < NUMROWS * NUMCOLS; ++i) {
+    blocks += cells[i] != 0;
+  }
+
+  sf::Vertex *vertices = Render::vertices(target, blocks * 4);
+  std::size_t count = 0;
+  auto square = [&](int col, int row, int type) {
+    sf::Vector2f corner(origin.x + col * size - Piece::OUTLINE,
+                        origin.y + row * size - Piece::OUTLINE);
+    Render::square(&vertices[count], corner, size + 2 * Piece::OUTLINE,
+                   Piece::color(type));
+    count += 4;
+  };
+  for (int row = 0; row < NUMROWS; ++row) {
+    for (int col = 0; col < NUMCOLS; ++col) {
+      if (cells[row * NUMCOLS + col] != 0) {
+        square(col, row, cells[row * NUMCOLS + col]);
+      }
+    }
+  }
+
+  if (!t.lost[board]) {
+    const Shape &piece = shape(t, t.type[board], t.orientation[board]);
+    for (int i = 0; i < SHAPE_ROWS; ++i) {
+      Row mask = at(piece[i], t.x[board]);
+      for (int col = 0; col < NUMCOLS; ++col) {
+        if (mask & (Row(1) << (col + GUTTER))) {
+          square(col, t.y[board] + SHAPE_TOP + i, t.type[board]);
+        }
+      }
+    }
+  }
+  Render::draw(target, vertices, count, sf::Quads);
+}
+
+} // namespace Pool
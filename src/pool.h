@@ -0,0 +1,122 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include "constants.h"
+#include "render.h"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Many standard boards played side by side, for the versus and bot wall
+// modes. Stored as a structure of arrays: one array per field, indexed by
+// board, so that a step over all the boards is a few tight loops instead of
+// a State::step per board.
+namespace Pool {
+
+// A row of cells between walls: the cells are the bits GUTTER to
+// GUTTER + NUMCOLS - 1, the others are set. A piece reaches at most two
+// cells away from its position, so it is tested without bounds checks.
+using Row = std::uint32_t;
+constexpr int GUTTER = 2;
+constexpr Row EMPTY_ROW = ~(((Row(1) << NUMCOLS) - 1) << GUTTER);
+constexpr Row FULL_ROW = ~Row(0);
+// Rows of a board: GUTTER empty rows above the grid, and full ones below,
+// one more so that a piece on the floor can be tested a row lower
+constexpr int STRIDE = NUMROWS + 2 * GUTTER + 1;
+
+// Cells of a piece in each of the rows from one above to two below its
+// position, for a piece in the column 0
+constexpr int SHAPE_TOP = -1;
+constexpr int SHAPE_ROWS = 4;
+using Shape = std::array<Row, SHAPE_ROWS>;
+
+constexpr int TYPES = 7;
+constexpr int SOFT_DROP_FACTOR = 20;
+
+// What a board is asked to do during the next step
+enum Input : std::uint8_t {
+  LEFT = 1,
+  RIGHT = 2,
+  ROTATE = 4,
+  SOFT_DROP = 8,
+  HARD_DROP = 16,
+  COUNTER_ROTATE = 32,
+};
+
+struct T {
+  int count = 0;
+  unsigned int seed = 0;
+  // Indexed by type - 1 and orientation, from Piece::blocks
+  std::array<Shape, TYPES * 4> shapes;
+
+  // STRIDE rows per board, board after board
+  std::vector<Row> rows;
+  // NUMROWS * NUMCOLS types per board, only read to draw
+  std::vector<std::uint8_t> cells;
+
+  // The active pieces, orientation from 0 to 3
+  std::vector<std::int8_t> x;
+  std::vector<std::int8_t> y;
+  std::vector<std::uint8_t> orientation;
+  std::vector<std::uint8_t> type;
+  std::vector<std::uint8_t> next;
+  // State of the generator of pieces, xorshift
+  std::vector<std::uint32_t> random;
+  // In steps, a soft drop counts SOFT_DROP_FACTOR per step
+  std::vector<std::uint16_t> sinceFall;
+  std::vector<std::uint16_t> fallInterval;
+
+  std::vector<std::int32_t> score;
+  std::vector<std::int32_t> lines;
+  std::vector<std::int32_t> pieces;
+  // Garbage rows to push up at the next lock
+  std::vector<std::uint8_t> garbage;
+  std::vector<std::uint8_t> lost;
+
+  // Set by the caller before a step and cleared by it
+  std::vector<std::uint8_t> input;
+  // What happened during the last step
+  std::vector<std::uint8_t> locked;
+  std::vector<std::uint8_t> cleared;
+
+  // Filled by step for its passes, one row of all the boards after another:
+  // SHAPE_ROWS rows of the piece moved to its column, and the rows of the
+  // board it covers and the one below
+  std::vector<Row> piece;
+  std::vector<Row> around;
+};
+
+// `count` empty boards, each with its own sequence of pieces
+T init(int count, unsigned int seed);
+
+// An empty board and a new sequence, the other boards go on
+void restart(T &t, int board);
+
+// Advances every board that has not lost by one fixed step
+void step(T &t);
+
+const Row *rows(const T &t, int board);
+// Bits of a row of a shape moved to the column `x`, which is down to
+// -GUTTER when a move left is tested against the wall
+Row at(Row mask, int x);
+const Shape &shape(const T &t, int type, int orientation);
+
+// Against the walls, the floor or the stack, `rows` of a board
+bool collides(const Row *rows, const Shape &shape, int x, int y);
+
+// Turns a piece of the type of the one of `board` by `offset`, 1 clockwise
+// and -1 counter-clockwise, at the first of its kicks that fits like in
+// State. False when none does, and the piece is left as it was. Kicks above
+// the rows kept over the grid do not fit.
+bool turn(const T &t, int board, int offset, int &orientation, int &x,
+          int &y);
+
+// `origin` is the top left corner of the grid and `size` the side of a cell,
+// in pixels. The grid itself is drawn by Grid.
+void draw(const T &t, int board, Render::T &target, sf::Vector2f origin,
+          float size);
+
+} // namespace Pool
+
+#endif // !POOL_H
@@ -0,0 +1,117 @@
+#include "profile.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Profile {
+
+using Clock = std::chrono::steady_clock;
+
+const Clock::time_point EPOCH = Clock::now();
+
+// An event read while its thread may overwrite it, a sequence lock: the
+// sequence is odd while written, and 2 * (n + 1) once the nth event of the
+// thread is complete
+struct Slot {
+  std::atomic<std::size_t> sequence = 0;
+  std::atomic<const char *> name = nullptr;
+  std::atomic<std::int64_t> start = 0;
+  std::atomic<std::int64_t> duration = 0;
+};
+
+// Written by one thread only, read by whoever writes the trace
+struct Buffer {
+  std::array<Slot, CAPACITY> slots;
+  std::atomic<std::size_t> write = 0;
+  int thread = 0;
+};
+
+// Buffers outlive their threads so that a trace can still show them
+std::mutex registryMutex;
+std::vector<std::unique_ptr<Buffer>> registry;
+
+// Allocated and registered on the first zone of each thread
+Buffer &local() {
+  thread_local Buffer *buffer = nullptr;
+  if (buffer == nullptr) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    registry.push_back(std::make_unique<Buffer>());
+    buffer = registry.back().get();
+    buffer->thread = int(registry.size());
+  }
+  return *buffer;
+}
+
+std::int64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                              EPOCH)
+      .count();
+}
+
+void record(const char *name, std::int64_t start, std::int64_t end) {
+  Buffer &buffer = local();
+  std::size_t write = buffer.write.load(std::memory_order_relaxed);
+  Slot &slot = buffer.slots[write % CAPACITY];
+  slot.sequence.store(2 * write + 1, std::memory_order_relaxed);
+  // The odd sequence is seen before any of the new fields
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.start.store(start, std::memory_order_relaxed);
+  slot.duration.store(end - start, std::memory_order_relaxed);
+  slot.sequence.store(2 * write + 2, std::memory_order_release);
+  buffer.write.store(write + 1, std::memory_order_release);
+}
+
+void writeEvent(const Event &event, int thread, std::ostream &out) {
+  out << "{\"name\": \"" << event.name << "\", \"ph\": \"X\", \"pid\": 1"
+      << ", \"tid\": " << thread << ", \"ts\": " << event.start / 1000.0
+      << ", \"dur\": " << event.duration / 1000.0 << "}";
+}
+
+void writeJson(std::ostream &out) {
+  std::lock_guard<std::mutex> lock(registryMutex);
+  bool isFirst = true;
+  // Microseconds with a nanosecond resolution, whatever the time
+  std::ios::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out << std::fixed << std::setprecision(3);
+
+  out << "{\"traceEvents\": [\n";
+  for (const auto &buffer : registry) {
+    std::size_t write = buffer->write.load(std::memory_order_acquire);
+    std::size_t from = write > CAPACITY ? write - CAPACITY : 0;
+
+    for (std::size_t i = from; i < write; ++i) {
+      const Slot &slot = buffer->slots[i % CAPACITY];
+      std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      Event event = {slot.name.load(std::memory_order_relaxed),
+                     slot.start.load(std::memory_order_relaxed),
+                     slot.duration.load(std::memory_order_relaxed)};
+      // Read before the sequence is checked again
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence != 2 * i + 2 ||
+          slot.sequence.load(std::memory_order_relaxed) != sequence) {
+        continue;
+      }
+      out << (isFirst ? "  " : ",\n  ");
+      writeEvent(event, buffer->thread, out);
+      isFirst = false;
+    }
+  }
+  out << "\n], \"displayTimeUnit\": \"ms\"}\n";
+  out.flags(flags);
+  out.precision(precision);
+}
+
+bool save(const std::string &path) {
+  std::ofstream out(path);
+  writeJson(out);
+  return bool(out);
+}
+
+} // namespace Profile
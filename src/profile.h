@@ -0,0 +1,55 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Scoped zones recorded per thread and written as Chrome trace events, to
+// open in ui.perfetto.dev or chrome://tracing. The macros compile to nothing
+// unless TETRIS_PROFILE is defined, see the CMake option of the same name.
+namespace Profile {
+
+// Zones kept per thread, the oldest are overwritten
+constexpr std::size_t CAPACITY = 1 << 16;
+
+struct Event {
+  // A string literal, only the pointer is kept
+  const char *name;
+  // In nanoseconds since the start of the process
+  std::int64_t start;
+  std::int64_t duration;
+};
+
+std::int64_t now();
+
+// Lock-free, into the buffer of the calling thread
+void record(const char *name, std::int64_t start, std::int64_t end);
+
+// The last zones of every thread, safe to call while they record: a zone
+// overwritten while it is read is left out
+void writeJson(std::ostream &out);
+bool save(const std::string &path);
+
+struct Zone {
+  const char *name;
+  std::int64_t start;
+
+  explicit Zone(const char *name) : name(name), start(now()) {}
+  ~Zone() { record(name, start, now()); }
+};
+
+} // namespace Profile
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+#ifdef TETRIS_PROFILE
+#define PROFILE_ZONE(name)                                                     \
+  Profile::Zone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#endif
+
+#endif // !PROFILE_H
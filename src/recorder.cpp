@@ -0,0 +1,234 @@
+#include "recorder.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace Recorder {
+
+constexpr auto WRITER_PERIOD = std::chrono::milliseconds(20);
+
+std::size_t putVarint(std::uint64_t value, unsigned char *out) {
+  std::size_t size = 0;
+  while (value >= 0x80) {
+    out[size++] = std::uint8_t(value) | 0x80;
+    value >>= 7;
+  }
+  out[size++] = std::uint8_t(value);
+  return size;
+}
+
+std::size_t putFixed(std::uint64_t value, std::size_t bytes,
+                     unsigned char *out) {
+  for (std::size_t i = 0; i < bytes; ++i) {
+    out[i] = std::uint8_t(value >> (8 * i));
+  }
+  return bytes;
+}
+
+bool getVarint(const unsigned char *data, std::size_t size,
+               std::size_t &position, std::uint64_t &value) {
+  value = 0;
+  for (int shift = 0; shift < 64 && position < size; shift += 7) {
+    unsigned char byte = data[position++];
+    value |= std::uint64_t(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool getFixed(const unsigned char *data, std::size_t size,
+              std::size_t &position, std::size_t bytes,
+              std::uint64_t &value) {
+  if (position + bytes > size) {
+    return false;
+  }
+  value = 0;
+  for (std::size_t i = 0; i < bytes; ++i) {
+    value |= std::uint64_t(data[position++]) << (8 * i);
+  }
+  return true;
+}
+
+std::uint32_t floatBits(float value) {
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+float bitsFloat(std::uint32_t bits) {
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+std::size_t encodeHeader(const Header &header, unsigned char *out) {
+  std::size_t size = 0;
+  size += putFixed(MAGIC, 4, out + size);
+  size += putFixed(VERSION, 2, out + size);
+  size += putFixed(header.seed, 4, out + size);
+  size += putFixed(std::uint64_t(header.das), 8, out + size);
+  size += putFixed(std::uint64_t(header.arr), 8, out + size);
+  size += putFixed(floatBits(header.softDropFactor), 4, out + size);
+  return size;
+}
+
+bool decodeHeader(const unsigned char *data, std::size_t size,
+                  std::size_t &position, Header &header) {
+  std::uint64_t magic, version, seed, das, arr, softDropFactor;
+  bool valid = getFixed(data, size, position, 4, magic) &&
+               getFixed(data, size, position, 2, version) &&
+               getFixed(data, size, position, 4, seed) &&
+               getFixed(data, size, position, 8, das) &&
+               getFixed(data, size, position, 8, arr) &&
+               getFixed(data, size, position, 4, softDropFactor);
+  if (!valid || magic != MAGIC || version != VERSION) {
+    return false;
+  }
+  header.seed = std::uint32_t(seed);
+  header.das = std::int64_t(das);
+  header.arr = std::int64_t(arr);
+  header.softDropFactor = bitsFloat(std::uint32_t(softDropFactor));
+  return true;
+}
+
+std::size_t encode(const Record &record, std::uint64_t previousTick,
+                   unsigned char *out) {
+  std::size_t size = putVarint(record.tick - previousTick, out);
+  out[size++] = record.kind;
+
+  switch (record.kind) {
+  case RELEASE:
+  case PRESS:
+    out[size++] = record.key;
+    size += putVarint(record.offset, out + size);
+    break;
+  case SPEED:
+    size += putFixed(floatBits(record.speed), 4, out + size);
+    break;
+  case END:
+    break;
+  }
+  return size;
+}
+
+bool decode(const unsigned char *data, std::size_t size,
+            std::size_t &position, std::uint64_t previousTick,
+            Record &record) {
+  std::uint64_t delta, value;
+  if (!getVarint(data, size, position, delta) || position >= size) {
+    return false;
+  }
+  record = Record{};
+  record.tick = previousTick + delta;
+  record.kind = Kind(data[position++]);
+
+  switch (record.kind) {
+  case RELEASE:
+  case PRESS:
+    if (position >= size) {
+      return false;
+    }
+    record.key = data[position++];
+    if (!getVarint(data, size, position, value)) {
+      return false;
+    }
+    record.offset = std::uint32_t(value);
+    return true;
+  case SPEED:
+    if (!getFixed(data, size, position, 4, value)) {
+      return false;
+    }
+    record.speed = bitsFloat(std::uint32_t(value));
+    return true;
+  case END:
+    return true;
+  }
+  return false;
+}
+
+// Writes everything pushed so far, returns false once END was written
+bool drain(T &t, std::uint64_t &previousTick) {
+  unsigned char buffer[MAX_SIZE];
+  std::size_t read = t.read.load(std::memory_order_relaxed);
+  std::size_t write = t.write.load(std::memory_order_acquire);
+  bool isOver = false;
+
+  for (; read != write; ++read) {
+    const Record &record = t.records[read % CAPACITY];
+    std::size_t size = encode(record, previousTick, buffer);
+    std::fwrite(buffer, 1, size, t.file);
+    previousTick = record.tick;
+    isOver = isOver || record.kind == END;
+  }
+  t.read.store(read, std::memory_order_release);
+  return !isOver;
+}
+
+void writeLoop(T &t) {
+  std::uint64_t previousTick = 0;
+  while (drain(t, previousTick)) {
+    std::this_thread::sleep_for(WRITER_PERIOD);
+  }
+  std::fclose(t.file);
+  t.file = nullptr;
+}
+
+bool start(T &t, const std::string &path, const Header &header) {
+  if (isRecording(t)) {
+    return false;
+  }
+  t.file = std::fopen(path.c_str(), "wb");
+  if (t.file == nullptr) {
+    return false;
+  }
+
+  unsigned char buffer[MAX_SIZE];
+  std::fwrite(buffer, 1, encodeHeader(header, buffer), t.file);
+
+  t.read = 0;
+  t.write = 0;
+  t.overflows = 0;
+  t.running = true;
+  t.writer = std::thread(writeLoop, std::ref(t));
+  return true;
+}
+
+bool isRecording(const T &t) { return t.running; }
+
+void push(T &t, const Record &record) {
+  if (!t.running) {
+    return;
+  }
+  std::size_t write = t.write.load(std::memory_order_relaxed);
+  if (write - t.read.load(std::memory_order_acquire) == CAPACITY) {
+    t.overflows += 1;
+    return;
+  }
+  t.records[write % CAPACITY] = record;
+  t.write.store(write + 1, std::memory_order_release);
+}
+
+void stop(T &t, std::uint64_t tick) {
+  if (!t.running) {
+    return;
+  }
+  Record end;
+  end.tick = tick;
+  end.kind = END;
+
+  // The END record must get through, wait for room if needed
+  while (t.write - t.read == CAPACITY) {
+    std::this_thread::sleep_for(WRITER_PERIOD);
+  }
+  push(t, end);
+
+  t.writer.join();
+  t.running = false;
+}
+
+} // namespace Recorder
@@ -0,0 +1,97 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+// Records the input of a game. With the seed and the handling, it is all
+// it takes to play the same game again, see Replay.
+//
+// File format, little endian:
+//   header: magic, version, seed, DAS and ARR in microseconds, soft drop
+//   then records: tick delta (varint), kind (byte) and for
+//     - PRESS and RELEASE: key (byte), offset in the step (varint, us)
+//     - SPEED: speed (float)
+//     - END: nothing, the tick is the last one of the game
+namespace Recorder {
+
+constexpr std::uint32_t MAGIC = 0x52525454; // "TTRR"
+// 2 since the pieces turn with SRS, 3 since the queue is drawn with
+// xorshift: older games no longer play back
+constexpr std::uint16_t VERSION = 3;
+// Records waiting for the writer thread, must be a power of two
+constexpr std::size_t CAPACITY = 4096;
+
+enum Kind : std::uint8_t {
+  RELEASE,
+  PRESS,
+  SPEED,
+  END,
+};
+
+struct Header {
+  std::uint32_t seed = 0;
+  std::int64_t das = 0;
+  std::int64_t arr = 0;
+  float softDropFactor = 0.f;
+};
+
+struct Record {
+  std::uint64_t tick = 0;
+  Kind kind = END;
+  std::uint8_t key = 0;
+  std::uint32_t offset = 0;
+  float speed = 0.f;
+};
+
+// The game thread pushes into a single producer single consumer ring, a
+// background thread encodes and writes. Initialise in place, do not copy.
+struct T {
+  std::array<Record, CAPACITY> records;
+  std::atomic<std::size_t> read = 0;
+  std::atomic<std::size_t> write = 0;
+  std::atomic<bool> running = false;
+  std::thread writer;
+  std::FILE *file = nullptr;
+  // Records lost because the writer could not keep up
+  std::size_t overflows = 0;
+};
+
+bool start(T &t, const std::string &path, const Header &header);
+
+bool isRecording(const T &t);
+
+// Never blocks nor allocates
+void push(T &t, const Record &record);
+
+// Records the end of the game and waits for everything to be written
+void stop(T &t, std::uint64_t tick);
+
+// Encoding, shared with Replay. Buffers must hold at least MAX_SIZE bytes.
+constexpr std::size_t MAX_SIZE = 32;
+std::size_t encodeHeader(const Header &header, unsigned char *out);
+std::size_t encode(const Record &record, std::uint64_t previousTick,
+                   unsigned char *out);
+bool decodeHeader(const unsigned char *data, std::size_t size,
+                  std::size_t &position, Header &header);
+bool decode(const unsigned char *data, std::size_t size,
+            std::size_t &position, std::uint64_t previousTick,
+            Record &record);
+
+// Little endian integers, shared with Spectator
+std::size_t putVarint(std::uint64_t value, unsigned char *out);
+std::size_t putFixed(std::uint64_t value, std::size_t bytes,
+                     unsigned char *out);
+bool getVarint(const unsigned char *data, std::size_t size,
+               std::size_t &position, std::uint64_t &value);
+bool getFixed(const unsigned char *data, std::size_t size,
+              std::size_t &position, std::size_t bytes, std::uint64_t &value);
+
+} // namespace Recorder
+
+#endif // !RECORDER_H
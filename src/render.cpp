@@ -0,0 +1,139 @@
+#include "render.h"
+#include "arena.h"
+#include <SFML/Graphics.hpp>
+#include <ostream>
+#include <string_view>
+
+namespace Render {
+
+T init(sf::RenderTarget &target, std::size_t arenaCapacity) {
+  T t = T{};
+  t.target = &target;
+  t.arena = Arena::init(arenaCapacity);
+  return t;
+}
+
+sf::Vertex *vertices(T &t, std::size_t count) {
+  return Arena::make<sf::Vertex>(t.arena, count);
+}
+
+void count(T &t, std::size_t vertices, const sf::RenderStates &states) {
+  t.frame.drawCalls += 1;
+  t.frame.vertices += vertices;
+
+  if (states.texture != t.texture) {
+    t.frame.stateChanges += 1;
+    if (states.texture != nullptr) {
+      t.frame.textureBinds += 1;
+    }
+    t.texture = states.texture;
+  }
+  if (states.shader != t.shader) {
+    t.frame.stateChanges += 1;
+    t.shader = states.shader;
+  }
+  if (states.blendMode != t.blendMode) {
+    t.frame.stateChanges += 1;
+    t.blendMode = states.blendMode;
+  }
+}
+
+void draw(T &t, const sf::Shape &shape, const sf::RenderStates &states) {
+  sf::RenderStates shapeStates = states;
+  shapeStates.texture = shape.getTexture();
+
+  // sf::Shape issues a triangle fan for the fill...
+  count(t, shape.getPointCount() + 2, shapeStates);
+
+  // ...and an untextured triangle strip for the outline
+  if (shape.getOutlineThickness() != 0.0f) {
+    shapeStates.texture = nullptr;
+    count(t, (shape.getPointCount() + 1) * 2, shapeStates);
+  }
+
+  t.target->draw(shape, states);
+}
+
+void draw(T &t, const sf::Text &text, const sf::RenderStates &states) {
+  const sf::Font *font = text.getFont();
+  if (font == nullptr) {
+    return;
+  }
+
+  // Two triangles per visible glyph, plus one quad per line decoration
+  const sf::String &string = text.getString();
+  std::size_t vertices = 0;
+  for (std::size_t i = 0; i < string.getSize(); ++i) {
+    sf::Uint32 c = string[i];
+    if (c != ' ' && c != '\t' && c != '\n') {
+      vertices += 6;
+    }
+  }
+  if (text.getStyle() & (sf::Text::Underlined | sf::Text::StrikeThrough)) {
+    vertices += 6;
+  }
+
+  sf::RenderStates textStates = states;
+  textStates.texture = &font->getTexture(text.getCharacterSize());
+  count(t, vertices, textStates);
+
+  t.target->draw(text, states);
+}
+
+void draw(T &t, const sf::VertexArray &vertices,
+          const sf::RenderStates &states) {
+  if (vertices.getVertexCount() == 0) {
+    return;
+  }
+  count(t, vertices.getVertexCount(), states);
+  t.target->draw(vertices, states);
+}
+
+void draw(T &t, const sf::Vertex *vertices, std::size_t vertexCount,
+          sf::PrimitiveType type, const sf::RenderStates &states) {
+  if (vertexCount == 0) {
+    return;
+  }
+  count(t, vertexCount, states);
+  t.target->draw(vertices, vertexCount, type, states);
+}
+
+void square(sf::Vertex *quad, sf::Vector2f corner, float size,
+            sf::Color color) {
+  quad[0] = sf::Vertex(corner, color);
+  quad[1] = sf::Vertex(corner + sf::Vector2f(size, 0.f), color);
+  quad[2] = sf::Vertex(corner + sf::Vector2f(size, size), color);
+  quad[3] = sf::Vertex(corner + sf::Vector2f(0.f, size), color);
+}
+
+void setString(sf::Text &text, sf::String &scratch, std::string_view string) {
+  scratch.clear();
+  for (char c : string) {
+    scratch += sf::String(sf::Uint32(c));
+  }
+  text.setString(scratch);
+}
+
+void primeText(sf::Text &text, sf::String &scratch,
+               std::string_view characters) {
+  setString(text, scratch, characters);
+  // Builds the vertices, which loads the glyphs
+  text.getLocalBounds();
+}
+
+void endFrame(T &t) {
+  t.frame.arenaBytes = Arena::size(t.arena);
+  Arena::reset(t.arena);
+  t.last = t.frame;
+  t.frame = Stats{};
+}
+
+void writeJson(const Stats &stats, std::ostream &out) {
+  out << "{\"draw_calls\": " << stats.drawCalls
+      << ", \"vertices\": " << stats.vertices
+      << ", \"state_changes\": " << stats.stateChanges
+      << ", \"texture_binds\": " << stats.textureBinds
+      << ", \"arena_bytes\": " << stats.arenaBytes << "}";
+}
+
+} // namespace Render
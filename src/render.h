@@ -0,0 +1,75 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include "arena.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+
+namespace Render {
+
+// Enough for the board and a few thousand particles, grows past that
+constexpr std::size_t ARENA_CAPACITY = 256 * 1024;
+
+struct Stats {
+  std::size_t drawCalls = 0;
+  std::size_t vertices = 0;
+  std::size_t stateChanges = 0;
+  std::size_t textureBinds = 0;
+  // Taken from the arena
+  std::size_t arenaBytes = 0;
+};
+
+// Thin wrapper around a render target counting what reaches the driver.
+// Every draw function of the game goes through it instead of the window.
+// Move only.
+struct T {
+  sf::RenderTarget *target;
+  Stats frame;
+  Stats last;
+  // For the vertices built while drawing, reset by endFrame
+  Arena::T arena;
+
+  const sf::Texture *texture = nullptr;
+  const sf::Shader *shader = nullptr;
+  sf::BlendMode blendMode;
+};
+
+T init(sf::RenderTarget &target, std::size_t arenaCapacity = ARENA_CAPACITY);
+
+// Valid until the end of the frame
+sf::Vertex *vertices(T &t, std::size_t count);
+
+void draw(T &t, const sf::Shape &shape,
+          const sf::RenderStates &states = sf::RenderStates::Default);
+void draw(T &t, const sf::Text &text,
+          const sf::RenderStates &states = sf::RenderStates::Default);
+void draw(T &t, const sf::VertexArray &vertices,
+          const sf::RenderStates &states = sf::RenderStates::Default);
+void draw(T &t, const sf::Vertex *vertices, std::size_t count,
+          sf::PrimitiveType type,
+          const sf::RenderStates &states = sf::RenderStates::Default);
+
+// Writes the four corners of a square for a sf::Quads draw
+void square(sf::Vertex *quad, sf::Vector2f corner, float size, sf::Color color);
+
+// Building a sf::String allocates once it is longer than a few characters,
+// this goes through `scratch` instead. Neither it nor the text allocate once
+// they have held a string as long, see primeText.
+void setString(sf::Text &text, sf::String &scratch, std::string_view string);
+
+// Loads the glyphs of `characters` and grows the text and `scratch` to hold
+// as many, so that setting them later does not allocate
+void primeText(sf::Text &text, sf::String &scratch,
+               std::string_view characters);
+
+// Publishes the counters of the frame to `last` and starts a new one, which
+// releases the vertices
+void endFrame(T &t);
+
+void writeJson(const Stats &stats, std::ostream &out);
+
+} // namespace Render
+
+#endif // !RENDER_H
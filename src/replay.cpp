@@ -0,0 +1,87 @@
+#include "replay.h"
+#include "keys.h"
+#include "mapped.h"
+#include "recorder.h"
+#include "state.h"
+#include <string>
+
+namespace Replay {
+
+void readNext(T &t) {
+  std::uint64_t previousTick = t.next.tick;
+  t.hasNext = Recorder::decode(t.file.data, t.file.size, t.position,
+                               previousTick, t.next);
+}
+
+bool open(T &t, const std::string &path) {
+  if (!Mapped::open(t.file, path)) {
+    return false;
+  }
+  t.position = 0;
+  if (!Recorder::decodeHeader(t.file.data, t.file.size, t.position,
+                              t.header)) {
+    Mapped::close(t.file);
+    return false;
+  }
+  t.next = Recorder::Record{};
+  t.isOver = false;
+  readNext(t);
+  return true;
+}
+
+void close(T &t) { Mapped::close(t.file); }
+
+State::T init(const T &t) {
+  State::T state = State::init(t.header.seed);
+  state.handling.das = sf::microseconds(t.header.das);
+  state.handling.arr = sf::microseconds(t.header.arr);
+  state.handling.softDropFactor = t.header.softDropFactor;
+  state.name = State::Name::PLAYING;
+  return state;
+}
+
+State::T feed(T &t, State::T state, Keys::T &keys) {
+  while (t.hasNext && t.next.tick <= state.tick) {
+    const Recorder::Record &record = t.next;
+
+    switch (record.kind) {
+    case Recorder::PRESS:
+    case Recorder::RELEASE:
+      Keys::push(keys, {sf::Keyboard::Key(record.key),
+                        record.kind == Recorder::PRESS,
+                        state.time + sf::microseconds(record.offset),
+                        sf::Time::Zero});
+      break;
+    case Recorder::SPEED:
+      state.speed = record.speed;
+      break;
+    case Recorder::END:
+      t.isOver = true;
+      break;
+    }
+    readNext(t);
+  }
+
+  // A truncated file ends where its records do
+  if (!t.hasNext) {
+    t.isOver = true;
+  }
+  return state;
+}
+
+State::T run(T &t, State::T state) {
+  Keys::T keys;
+  while (true) {
+    state = feed(t, state, keys);
+    if (t.isOver) {
+      return state;
+    }
+    state = State::step(state, keys);
+    state.events = State::Events{};
+    if (state.name == State::Name::LOST) {
+      return state;
+    }
+  }
+}
+
+} // namespace Replay
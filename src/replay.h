@@ -0,0 +1,40 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "keys.h"
+#include "mapped.h"
+#include "recorder.h"
+#include "state.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Replay {
+
+// Plays a file written by Recorder back through the fixed-step path
+struct T {
+  Mapped::T file;
+  Recorder::Header header;
+  std::size_t position = 0;
+  Recorder::Record next;
+  bool hasNext = false;
+  bool isOver = false;
+};
+
+bool open(T &t, const std::string &path);
+
+void close(T &t);
+
+// A new game, as it was when the recording started
+State::T init(const T &t);
+
+// Pushes the input recorded for the coming step of `state` into `keys`
+State::T feed(T &t, State::T state, Keys::T &keys);
+
+// Plays the rest of the replay without a window, as fast as possible, up to
+// its end or the game over
+State::T run(T &t, State::T state);
+
+} // namespace Replay
+
+#endif // !REPLAY_H
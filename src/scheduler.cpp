@@ -0,0 +1,100 @@
+#include "scheduler.h"
+#include "constants.h"
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+namespace Scheduler {
+
+// Below this margin the OS scheduler cannot be trusted to wake us up on time
+constexpr auto spinMargin = std::chrono::microseconds(1500);
+constexpr auto stepDuration = std::chrono::duration_cast<Clock::duration>(
+    std::chrono::duration<float>(fixedTimeStep));
+
+T init(Policy policy) {
+  T t = T{};
+  t.policy = policy;
+  t.framerateLimit = static_cast<unsigned int>(fixedNumberOfFrames);
+  t.nextFrame = Clock::now() + stepDuration;
+  t.wallStart = Clock::now();
+  t.cpuStart = std::clock();
+  return t;
+}
+
+bool parsePolicy(const std::string &name, Policy &policy) {
+  if (name == "vsync") {
+    policy = VSYNC;
+  } else if (name == "cap") {
+    policy = FIXED_CAP;
+  } else if (name == "sleep") {
+    policy = PRECISE_SLEEP;
+  } else {
+    std::cerr << "Unknown loop policy: " << name << std::endl;
+    return false;
+  }
+  return true;
+}
+
+const char *name(Policy policy) {
+  switch (policy) {
+  case VSYNC:
+    return "vsync";
+  case FIXED_CAP:
+    return "cap";
+  case PRECISE_SLEEP:
+    return "sleep";
+  }
+  return "unknown";
+}
+
+void apply(const T &t, sf::RenderWindow &window) {
+  window.setVerticalSyncEnabled(t.policy == VSYNC);
+  window.setFramerateLimit(t.policy == FIXED_CAP ? t.framerateLimit : 0);
+}
+
+bool nextEvent(sf::RenderWindow &window, sf::Event &event, bool &shouldWait) {
+  if (shouldWait) {
+    shouldWait = false;
+    return window.waitEvent(event);
+  }
+  return window.pollEvent(event);
+}
+
+void sleepUntil(Clock::time_point deadline) {
+  if (deadline - Clock::now() > spinMargin) {
+    std::this_thread::sleep_until(deadline - spinMargin);
+  }
+  while (Clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+}
+
+void measure(T &t) {
+  auto now = Clock::now();
+  float wall = std::chrono::duration<float>(now - t.wallStart).count();
+  if (wall < t.measureEvery) {
+    return;
+  }
+
+  float cpu = float(std::clock() - t.cpuStart) / CLOCKS_PER_SEC;
+  t.utilisation = cpu / wall;
+
+  t.wallStart = now;
+  t.cpuStart = std::clock();
+}
+
+void endFrame(T &t) {
+  if (t.policy == PRECISE_SLEEP) {
+    sleepUntil(t.nextFrame);
+    t.nextFrame += stepDuration;
+    // Do not try to catch up on frames we were too slow to render
+    if (t.nextFrame < Clock::now()) {
+      t.nextFrame = Clock::now() + stepDuration;
+    }
+  }
+  measure(t);
+}
+
+} // namespace Scheduler
@@ -0,0 +1,52 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <ctime>
+#include <string>
+
+namespace Scheduler {
+
+enum Policy {
+  // Let the driver block in display() until the next vertical blank
+  VSYNC,
+  // SFML's setFramerateLimit, which relies on the coarse sf::sleep
+  FIXED_CAP,
+  // Sleep on a steady clock until the next fixed step, then spin the rest
+  PRECISE_SLEEP,
+};
+
+using Clock = std::chrono::steady_clock;
+
+struct T {
+  Policy policy = PRECISE_SLEEP;
+  unsigned int framerateLimit = 60;
+  Clock::time_point nextFrame;
+
+  // CPU utilisation of the whole process over the last measureEvery
+  // seconds, 1 for a whole core
+  Clock::time_point wallStart;
+  std::clock_t cpuStart;
+  float utilisation = 0.0f;
+  float measureEvery = 5.0f;
+};
+
+T init(Policy policy);
+
+// One of "vsync", "cap" or "sleep", false for anything else
+bool parsePolicy(const std::string &name, Policy &policy);
+const char *name(Policy policy);
+
+void apply(const T &t, sf::RenderWindow &window);
+
+// Blocks on waitEvent for the first event of an idle frame (menus, pause),
+// polls otherwise.
+bool nextEvent(sf::RenderWindow &window, sf::Event &event, bool &shouldWait);
+
+// Called once per frame after display()
+void endFrame(T &t);
+
+} // namespace Scheduler
+
+#endif // !SCHEDULER_H
@@ -0,0 +1,297 @@
+#include "constants.h"
+#include "match.h"
+#include "net.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+// Headless server of two player matches, see Match. The main thread
+// accepts the clients and pairs them, each worker thread owns the matches it
+// was given and steps them all at 60 Hz from one epoll loop.
+// Usage: tetris_server [--listen=/path/or/port] [--workers=N] [--seconds=S]
+// Prints statistics as JSON on stdout when stopped.
+
+namespace {
+
+constexpr int MAX_EVENTS = 256;
+// Sent to the clients in a byte, see Net::Welcome
+constexpr int MAX_WORKERS = 255;
+// How often the threads look at `running` when nothing happens
+constexpr int IDLE_MS = 100;
+
+std::atomic<bool> running = true;
+
+void stop(int) { running = false; }
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+struct Worker {
+  int index = 0;
+  int epoll = -1;
+  // Fires every fixed step
+  int timer = -1;
+  // Written by the main thread when there are new matches
+  int wake = -1;
+  std::mutex mutex;
+  std::vector<std::pair<int, int>> incoming;
+  // Allocated for their address to stay in the epoll events
+  std::vector<std::unique_ptr<Match::T>> matches;
+
+  std::uint64_t steps = 0;
+  // Steps due that the worker was too late to run
+  std::uint64_t lateSteps = 0;
+  std::uint64_t totalMatches = 0;
+  Clock::duration busy = Clock::duration::zero();
+  std::thread thread;
+};
+
+// A client that left while waiting for an opponent. Only peeks, what it sent
+// stays for its match.
+bool isClosed(int fd) {
+  char byte;
+  ssize_t size = recv(fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+  return size == 0 || (size < 0 && errno != EAGAIN && errno != EWOULDBLOCK);
+}
+
+bool watch(int epoll, int fd, void *data) {
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.ptr = data;
+  return epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
+bool init(Worker &t, int index) {
+  t.index = index;
+  t.epoll = epoll_create1(0);
+  t.timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+  t.wake = eventfd(0, EFD_NONBLOCK);
+  if (t.epoll < 0 || t.timer < 0 || t.wake < 0) {
+    return false;
+  }
+
+  itimerspec interval = {};
+  interval.it_interval.tv_nsec = fixedStep.asMicroseconds() * 1000;
+  interval.it_value = interval.it_interval;
+  return timerfd_settime(t.timer, 0, &interval, nullptr) == 0 &&
+         watch(t.epoll, t.timer, &t.timer) && watch(t.epoll, t.wake, &t.wake);
+}
+
+void startMatches(Worker &t, int workers) {
+  std::uint64_t count;
+  while (read(t.wake, &count, sizeof(count)) > 0) {
+  }
+
+  std::vector<std::pair<int, int>> incoming;
+  {
+    std::lock_guard<std::mutex> lock(t.mutex);
+    std::swap(incoming, t.incoming);
+  }
+  for (auto [first, second] : incoming) {
+    auto match = std::make_unique<Match::T>();
+    unsigned int seed = unsigned(t.index) << 24 ^ unsigned(t.totalMatches);
+    Match::init(*match, first, second, seed, workers);
+    if (!watch(t.epoll, first, match.get()) ||
+        !watch(t.epoll, second, match.get())) {
+      match->isOver = true;
+    }
+    Match::flush(*match);
+    t.matches.push_back(std::move(match));
+    t.totalMatches += 1;
+  }
+}
+
+void stepMatches(Worker &t) {
+  std::uint64_t expirations = 0;
+  if (read(t.timer, &expirations, sizeof(expirations)) <= 0) {
+    return;
+  }
+  // Behind by more than a few steps, give up on the oldest like the game
+  std::uint64_t steps = std::min<std::uint64_t>(expirations, maxStepsPerFrame);
+  t.lateSteps += expirations - 1;
+  t.steps += steps;
+
+  for (auto &match : t.matches) {
+    for (std::uint64_t i = 0; i < steps && !match->isOver; ++i) {
+      Match::step(*match);
+    }
+    Match::flush(*match);
+  }
+}
+
+// After the events of a batch, which may point to them. Closing the sockets
+// removes them from the epoll set.
+void removeOverMatches(Worker &t) {
+  auto over = std::stable_partition(
+      t.matches.begin(), t.matches.end(),
+      [](const auto &match) { return !match->isOver; });
+  for (auto it = over; it != t.matches.end(); ++it) {
+    Match::close(**it);
+  }
+  t.matches.erase(over, t.matches.end());
+}
+
+void work(Worker &t, int workers) {
+  epoll_event events[MAX_EVENTS];
+  while (running) {
+    int count = epoll_wait(t.epoll, events, MAX_EVENTS, IDLE_MS);
+    auto start = Clock::now();
+    for (int i = 0; i < count; ++i) {
+      void *data = events[i].data.ptr;
+      if (data == &t.timer) {
+        stepMatches(t);
+      } else if (data == &t.wake) {
+        startMatches(t, workers);
+      } else {
+        auto *match = static_cast<Match::T *>(data);
+        if (!match->isOver) {
+          Match::receive(*match);
+        }
+      }
+    }
+    removeOverMatches(t);
+    t.busy += Clock::now() - start;
+  }
+  for (auto &match : t.matches) {
+    Match::close(*match);
+  }
+}
+
+void writeJson(const std::vector<std::unique_ptr<Worker>> &workers,
+               double seconds, std::ostream &out) {
+  std::uint64_t steps = 0;
+  std::uint64_t lateSteps = 0;
+  std::uint64_t matches = 0;
+  double busy = 0.0;
+  for (const auto &worker : workers) {
+    steps += worker->steps;
+    lateSteps += worker->lateSteps;
+    matches += worker->totalMatches;
+    busy += std::chrono::duration<double>(worker->busy).count();
+  }
+  out << "{\"workers\": " << workers.size() << ", \"seconds\": " << seconds
+      << ", \"matches\": " << matches << ", \"steps\": " << steps
+      << ", \"late_steps\": " << lateSteps
+      << ", \"busy_per_worker\": " << busy / workers.size() / seconds << "}"
+      << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string address = "/tmp/tetris.sock";
+  int workerCount = std::clamp(int(std::thread::hardware_concurrency()), 1,
+                               MAX_WORKERS);
+  double duration = 0.0;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.rfind("--listen=", 0) == 0) {
+      address = arg.substr(9);
+    } else if (arg.rfind("--workers=", 0) == 0) {
+      if (!Net::parse(arg.substr(10), workerCount) || workerCount < 1 ||
+          workerCount > MAX_WORKERS) {
+        std::cerr << "Invalid option: " << arg << std::endl;
+        return 1;
+      }
+    } else if (arg.rfind("--seconds=", 0) == 0) {
+      // Until stopped with 0
+      if (!Net::parse(arg.substr(10), duration) || !std::isfinite(duration) ||
+          duration < 0.0) {
+        std::cerr << "Invalid option: " << arg << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::signal(SIGINT, stop);
+  std::signal(SIGTERM, stop);
+
+  int listener = Net::listen(address);
+  int epoll = epoll_create1(0);
+  if (listener < 0 || epoll < 0 || !watch(epoll, listener, nullptr)) {
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<Worker>> workers;
+  for (int i = 0; i < workerCount; ++i) {
+    workers.push_back(std::make_unique<Worker>());
+    if (!init(*workers.back(), i)) {
+      std::cerr << "Cannot start worker " << i << std::endl;
+      return 1;
+    }
+  }
+  for (auto &worker : workers) {
+    worker->thread = std::thread(work, std::ref(*worker), workerCount);
+  }
+  std::cerr << "Listening on " << address << " with " << workerCount
+            << " workers" << std::endl;
+
+  // Clients are paired in the order they connect, pairs go to the workers
+  // in turn
+  auto start = Clock::now();
+  int waiting = -1;
+  std::size_t next = 0;
+  epoll_event event;
+  while (running) {
+    if (duration > 0.0 && secondsSince(start) >= duration) {
+      break;
+    }
+    if (epoll_wait(epoll, &event, 1, IDLE_MS) <= 0) {
+      continue;
+    }
+    for (int fd = Net::accept(listener); fd >= 0; fd = Net::accept(listener)) {
+      if (waiting >= 0 && isClosed(waiting)) {
+        close(waiting);
+        waiting = -1;
+      }
+      if (waiting < 0) {
+        waiting = fd;
+        continue;
+      }
+      Worker &worker = *workers[next++ % workers.size()];
+      {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.incoming.push_back({waiting, fd});
+      }
+      std::uint64_t one = 1;
+      write(worker.wake, &one, sizeof(one));
+      waiting = -1;
+    }
+  }
+
+  running = false;
+  for (auto &worker : workers) {
+    worker->thread.join();
+  }
+  if (waiting >= 0) {
+    close(waiting);
+  }
+  close(listener);
+  if (address.find('/') != std::string::npos) {
+    unlink(address.c_str());
+  }
+
+  writeJson(workers, secondsSince(start), std::cout);
+  return 0;
+}
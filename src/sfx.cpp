@@ -0,0 +1,172 @@
+#include "sfx.h"
+#include "state.h"
+#include <SFML/Audio.hpp>
+#include <cmath>
+#include <iterator>
+#include <numbers>
+#include <vector>
+
+namespace Sfx {
+
+constexpr unsigned int SAMPLE_RATE = 44100;
+
+struct Tone {
+  // Swept linearly, in Hz
+  float from;
+  float to;
+  float duration;
+  bool isSquare;
+  float volume;
+};
+
+// Indexed by Effect
+constexpr Tone TONES[] = {
+    {220.f, 220.f, .03f, true, .2f},   // MOVE
+    {440.f, 660.f, .05f, false, .4f},  // ROTATE
+    {110.f, 80.f, .08f, true, .5f},    // LOCK
+    {523.f, 1046.f, .25f, false, .6f}, // LINE_CLEAR
+    {440.f, 110.f, .9f, true, .6f},    // GAME_OVER
+};
+static_assert(std::size(TONES) == NUMBER_OF_EFFECTS);
+
+void synthesise(sf::SoundBuffer &buffer, const Tone &tone) {
+  std::size_t count = std::size_t(tone.duration * SAMPLE_RATE);
+  std::vector<sf::Int16> samples(count);
+  float phase = 0.f;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    float progress = float(i) / count;
+    phase += (tone.from + (tone.to - tone.from) * progress) / SAMPLE_RATE;
+    phase -= std::floor(phase);
+
+    float wave = tone.isSquare
+                     ? (phase < .5f ? 1.f : -1.f)
+                     : std::sin(2.f * std::numbers::pi_v<float> * phase);
+    // Fades out, so that the end does not click
+    float envelope = (1.f - progress) * (1.f - progress);
+    samples[i] = sf::Int16(wave * envelope * tone.volume * 32767.f);
+  }
+  buffer.loadFromSamples(samples.data(), samples.size(), 1, SAMPLE_RATE);
+}
+
+void synthesise(Buffers &buffers) {
+  for (int effect = 0; effect < NUMBER_OF_EFFECTS; ++effect) {
+    synthesise(buffers[effect], TONES[effect]);
+  }
+}
+
+// A free voice if there is one. Otherwise the voice playing the least
+// important effect, the oldest first, unless it is more important than the
+// new one.
+int pickVoice(const T &t, Effect effect) {
+  int picked = -1;
+  for (std::size_t i = 0; i < VOICES; ++i) {
+    if (t.voices[i].getStatus() == sf::Sound::Stopped) {
+      return int(i);
+    }
+    if (t.playing[i] > effect) {
+      continue;
+    }
+    if (picked < 0 || t.playing[i] < t.playing[picked] ||
+        (t.playing[i] == t.playing[picked] &&
+         t.startedAt[i] < t.startedAt[picked])) {
+      picked = int(i);
+    }
+  }
+  return picked;
+}
+
+void play(T &t, Effect effect) {
+  int voice = pickVoice(t, effect);
+  if (voice < 0) {
+    t.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  sf::Sound &sound = t.voices[voice];
+  if (sound.getStatus() != sf::Sound::Stopped) {
+    sound.stop();
+    t.stolen.fetch_add(1, std::memory_order_relaxed);
+  }
+  sound.setBuffer((*t.buffers)[effect]);
+  sound.play();
+  t.playing[voice] = effect;
+  t.startedAt[voice] = t.played++;
+}
+
+void run(T &t) {
+  std::size_t read = t.read.load(std::memory_order_relaxed);
+  while (true) {
+    // Read first: a push from now on changes it and wakes the wait below
+    std::uint32_t signal = t.signal.load(std::memory_order_acquire);
+    std::size_t write = t.write.load(std::memory_order_acquire);
+
+    for (; read != write; ++read) {
+      play(t, t.requests[read % CAPACITY]);
+      t.read.store(read + 1, std::memory_order_release);
+    }
+
+    if (!t.running.load(std::memory_order_acquire)) {
+      break;
+    }
+    t.signal.wait(signal, std::memory_order_acquire);
+  }
+
+  for (auto &voice : t.voices) {
+    voice.stop();
+  }
+}
+
+void start(T &t, const Buffers &buffers) {
+  if (t.running) {
+    return;
+  }
+  t.buffers = &buffers;
+  t.running = true;
+  t.thread = std::thread(run, std::ref(t));
+}
+
+void stop(T &t) {
+  if (!t.running) {
+    return;
+  }
+  t.running.store(false, std::memory_order_release);
+  t.signal.fetch_add(1, std::memory_order_release);
+  t.signal.notify_one();
+  t.thread.join();
+}
+
+void push(T &t, Effect effect) {
+  if (!t.running.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::size_t write = t.write.load(std::memory_order_relaxed);
+  if (write - t.read.load(std::memory_order_acquire) == CAPACITY) {
+    t.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  t.requests[write % CAPACITY] = effect;
+  t.write.store(write + 1, std::memory_order_release);
+  t.signal.fetch_add(1, std::memory_order_release);
+  t.signal.notify_one();
+}
+
+void trigger(T &t, const State::Events &events) {
+  if (events.moved) {
+    push(t, MOVE);
+  }
+  if (events.rotated) {
+    push(t, ROTATE);
+  }
+  if (events.locked) {
+    push(t, LOCK);
+  }
+  if (events.clearedRows != 0) {
+    push(t, LINE_CLEAR);
+  }
+  if (events.lost) {
+    push(t, GAME_OVER);
+  }
+}
+
+} // namespace Sfx
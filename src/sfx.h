@@ -0,0 +1,71 @@
+#ifndef SFX_H
+#define SFX_H
+
+#include "state.h"
+#include <SFML/Audio.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+// Sound effects, played on a thread of their own. The game only pushes
+// requests into a lock-free queue: triggering never allocates or blocks.
+namespace Sfx {
+
+// In increasing importance, see play()
+enum Effect : std::uint8_t {
+  MOVE,
+  ROTATE,
+  LOCK,
+  LINE_CLEAR,
+  GAME_OVER,
+  NUMBER_OF_EFFECTS,
+};
+
+using Buffers = std::array<sf::SoundBuffer, NUMBER_OF_EFFECTS>;
+
+constexpr std::size_t VOICES = 8;
+// Requests waiting for the sound thread, must be a power of two
+constexpr std::size_t CAPACITY = 64;
+
+struct T {
+  const Buffers *buffers = nullptr;
+
+  // Only touched by the sound thread
+  std::array<sf::Sound, VOICES> voices;
+  std::array<Effect, VOICES> playing = {};
+  std::array<std::uint64_t, VOICES> startedAt = {};
+  std::uint64_t played = 0;
+
+  // Single producer, the game, single consumer, the sound thread
+  std::array<Effect, CAPACITY> requests = {};
+  std::atomic<std::size_t> read = 0;
+  std::atomic<std::size_t> write = 0;
+  // Bumped on every push and on stop, the sound thread sleeps on it
+  std::atomic<std::uint32_t> signal = 0;
+  std::atomic<bool> running = false;
+  std::thread thread;
+
+  // Requests given up because the queue was full or every voice was busy
+  // with something more important
+  std::atomic<std::uint32_t> dropped = 0;
+  std::atomic<std::uint32_t> stolen = 0;
+};
+
+// Short synthesised sounds, there is no file to ship for them
+void synthesise(Buffers &buffers);
+
+// The thread keeps a reference to t and to the buffers: initialise in place,
+// do not copy
+void start(T &t, const Buffers &buffers);
+void stop(T &t);
+
+// Ignored when not started
+void push(T &t, Effect effect);
+
+void trigger(T &t, const State::Events &events);
+
+} // namespace Sfx
+
+#endif // !SFX_H
@@ -0,0 +1,311 @@
+#include "snapshot.h"
+#include "mapped.h"
+#include "piece.h"
+#include "recorder.h"
+#include "state.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Snapshot {
+
+// CRC-32 as in zlib, one table lookup per byte
+constexpr std::array<std::uint32_t, 256> CRC_TABLE = [] {
+  std::array<std::uint32_t, 256> table = {};
+  for (std::uint32_t i = 0; i < 256; ++i) {
+    std::uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = crc & 1 ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+    }
+    table[i] = crc;
+  }
+  return table;
+}();
+
+std::uint32_t checksum(const unsigned char *data, std::size_t size) {
+  std::uint32_t crc = ~0u;
+  for (std::size_t i = 0; i < size; ++i) {
+    crc = CRC_TABLE[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+void put(std::vector<unsigned char> &out, std::uint64_t value,
+         std::size_t bytes) {
+  std::size_t at = out.size();
+  out.resize(at + bytes);
+  Recorder::putFixed(value, bytes, &out[at]);
+}
+
+void putTime(std::vector<unsigned char> &out, sf::Time time) {
+  put(out, std::uint64_t(time.asMicroseconds()), 8);
+}
+
+void putFloat(std::vector<unsigned char> &out, float value) {
+  put(out, std::bit_cast<std::uint32_t>(value), 4);
+}
+
+// Reads the payload in order, fails once past its end
+struct Reader {
+  const unsigned char *data;
+  std::size_t size;
+  std::size_t position = 0;
+  bool isValid = true;
+};
+
+std::uint64_t get(Reader &t, std::size_t bytes) {
+  std::uint64_t value = 0;
+  t.isValid = t.isValid && Recorder::getFixed(t.data, t.size, t.position,
+                                              bytes, value);
+  return value;
+}
+
+std::int32_t getInt(Reader &t) {
+  return std::int32_t(std::uint32_t(get(t, 4)));
+}
+
+sf::Time getTime(Reader &t) {
+  return sf::microseconds(std::int64_t(get(t, 8)));
+}
+
+float getFloat(Reader &t) {
+  return std::bit_cast<float>(std::uint32_t(get(t, 4)));
+}
+
+// Of the falling pieces
+bool isType(int type) { return type >= 1 && type < Piece::GARBAGE; }
+
+template <int Width, int Height>
+std::vector<unsigned char> encode(const State::Basic<Width, Height> &state) {
+  std::vector<unsigned char> out;
+  put(out, MAGIC, 4);
+  put(out, VERSION, 2);
+  put(out, Width, 1);
+  put(out, Height, 1);
+  // Payload size and checksum, known at the end
+  put(out, 0, 8);
+
+  put(out, state.seed, 4);
+  put(out, state.tick, 8);
+  putTime(out, state.time);
+  putTime(out, state.sinceFall);
+  putTime(out, state.sinceUpdate);
+  putTime(out, state.handling.das);
+  putTime(out, state.handling.arr);
+  putFloat(out, state.handling.softDropFactor);
+  put(out, std::uint32_t(state.shiftDirection), 4);
+  putTime(out, state.shiftPressedAt);
+  put(out, std::uint32_t(state.shiftRepeats), 4);
+  put(out, state.name, 1);
+  putFloat(out, state.speed);
+  put(out, std::uint32_t(state.score), 4);
+  put(out, std::uint32_t(state.lines), 4);
+  put(out, std::uint32_t(state.pieces), 4);
+  put(out, std::uint32_t(state.garbage), 4);
+  put(out, std::uint32_t(state.garbageHole), 4);
+  putTime(out, state.startTime);
+
+  const Piece::T &piece = state.piece;
+  put(out, piece.orientation, 1);
+  put(out, piece.type, 1);
+  put(out, std::uint32_t(piece.position.x), 4);
+  put(out, std::uint32_t(piece.position.y), 4);
+  for (int type : piece.next) {
+    put(out, type, 1);
+  }
+  put(out, piece.random, 4);
+
+  for (const auto &row : state.board.cells) {
+    out.insert(out.end(), row.begin(), row.end());
+  }
+
+  std::size_t size = out.size() - HEADER_SIZE;
+  Recorder::putFixed(size, 4, &out[8]);
+  Recorder::putFixed(checksum(&out[HEADER_SIZE], size), 4, &out[12]);
+  return out;
+}
+
+template <int Width, int Height>
+bool decode(const unsigned char *data, std::size_t size,
+            State::Basic<Width, Height> &state) {
+  using U = State::Basic<Width, Height>;
+  Reader header{data, size};
+  bool isValid = get(header, 4) == MAGIC && get(header, 2) == VERSION &&
+                 get(header, 1) == std::uint64_t(Width) &&
+                 get(header, 1) == std::uint64_t(Height);
+  std::size_t payloadSize = get(header, 4);
+  std::uint32_t crc = std::uint32_t(get(header, 4));
+  if (!isValid || !header.isValid || payloadSize != size - HEADER_SIZE ||
+      checksum(data + HEADER_SIZE, payloadSize) != crc) {
+    return false;
+  }
+
+  Reader t{data, size, HEADER_SIZE};
+  // Also what is not saved, like the range of the piece generator
+  U loaded = State::init<U>(std::uint32_t(get(t, 4)));
+  loaded.tick = get(t, 8);
+  loaded.time = getTime(t);
+  loaded.sinceFall = getTime(t);
+  loaded.sinceUpdate = getTime(t);
+  loaded.handling.das = getTime(t);
+  loaded.handling.arr = getTime(t);
+  loaded.handling.softDropFactor = getFloat(t);
+  loaded.shiftDirection = getInt(t);
+  loaded.shiftPressedAt = getTime(t);
+  loaded.shiftRepeats = getInt(t);
+  loaded.name = State::Name(get(t, 1));
+  loaded.speed = getFloat(t);
+  loaded.score = getInt(t);
+  loaded.lines = getInt(t);
+  loaded.pieces = getInt(t);
+  loaded.garbage = getInt(t);
+  loaded.garbageHole = getInt(t);
+  loaded.startTime = getTime(t);
+
+  int orientation = int(get(t, 1));
+  int type = int(get(t, 1));
+  sf::Vector2i position;
+  position.x = getInt(t);
+  position.y = getInt(t);
+  bool isPiece = isType(type) && orientation >= 1 && orientation <= 4;
+  for (int &next : loaded.piece.next) {
+    next = int(get(t, 1));
+    isPiece = isPiece && isType(next);
+  }
+  loaded.piece.random = std::uint32_t(get(t, 4));
+  if (!isPiece || loaded.name > State::Name::WON || !t.isValid ||
+      loaded.piece.random == 0) {
+    return false;
+  }
+  loaded.piece = Piece::set(loaded.piece, orientation, type, position);
+
+  // The rows are rebuilt from the cells, they cannot disagree
+  using Row = typename decltype(loaded.board)::Row;
+  for (int row = 0; row < Height && t.isValid; ++row) {
+    for (int col = 0; col < Width; ++col) {
+      std::uint8_t cell = std::uint8_t(get(t, 1));
+      t.isValid = t.isValid && (cell == 0 || cell == Piece::GARBAGE ||
+                                isType(cell));
+      loaded.board.cells[row][col] = cell;
+      if (cell != 0) {
+        loaded.board.rows[row] |= Row(1) << col;
+      }
+    }
+  }
+  if (!t.isValid || t.position != size) {
+    return false;
+  }
+  state = loaded;
+  return true;
+}
+
+template <int Width, int Height>
+bool save(const State::Basic<Width, Height> &state, const std::string &path) {
+  std::vector<unsigned char> data = encode(state);
+  std::string temporary = path + ".tmp";
+  std::FILE *file = std::fopen(temporary.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool isWritten = std::fwrite(data.data(), 1, data.size(), file) ==
+                   data.size();
+  isWritten = std::fclose(file) == 0 && isWritten;
+
+  std::error_code error;
+  if (isWritten) {
+    std::filesystem::rename(temporary, path, error);
+  }
+  if (!isWritten || error) {
+    std::remove(temporary.c_str());
+    return false;
+  }
+  return true;
+}
+
+template <int Width, int Height>
+bool load(const std::string &path, State::Basic<Width, Height> &state) {
+  Mapped::T file;
+  if (!Mapped::open(file, path)) {
+    return false;
+  }
+  bool isLoaded = decode(file.data, file.size, state);
+  Mapped::close(file);
+  return isLoaded;
+}
+
+void writeLoop(Autosave &t) {
+  std::unique_lock<std::mutex> lock(t.mutex);
+  while (true) {
+    t.wake.wait(lock, [&t] { return t.hasPending || !t.running; });
+    if (!t.hasPending) {
+      return;
+    }
+    State::T state = t.pending;
+    t.hasPending = false;
+    lock.unlock();
+
+    bool isDone = state.name == State::Name::LOST
+                      ? std::remove(t.path.c_str()) == 0
+                      : save(state, t.path);
+    lock.lock();
+    t.saves += isDone ? 1 : 0;
+  }
+}
+
+bool start(Autosave &t, const std::string &path) {
+  if (isSaving(t)) {
+    return false;
+  }
+  t.path = path;
+  t.hasPending = false;
+  t.running = true;
+  t.saves = 0;
+  t.writer = std::thread(writeLoop, std::ref(t));
+  return true;
+}
+
+bool isSaving(const Autosave &t) { return t.running; }
+
+void request(Autosave &t, const State::T &state) {
+  if (!t.running) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(t.mutex);
+    t.pending = state;
+    t.hasPending = true;
+  }
+  t.wake.notify_one();
+}
+
+void stop(Autosave &t) {
+  if (!t.running) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(t.mutex);
+    t.running = false;
+  }
+  t.wake.notify_one();
+  t.writer.join();
+}
+
+#define INSTANTIATE(U)                                                         \
+  template std::vector<unsigned char> encode(const U &);                       \
+  template bool decode(const unsigned char *, std::size_t, U &);               \
+  template bool save(const U &, const std::string &);                          \
+  template bool load(const std::string &, U &);
+
+INSTANTIATE(State::T)
+INSTANTIATE(State::Drill)
+INSTANTIATE(State::Marathon)
+INSTANTIATE(State::Party)
+
+} // namespace Snapshot
@@ -0,0 +1,76 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "state.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Everything a game needs to go on where it was: the board, the piece and
+// its generator, the timers, the speed and the score. Taken between two
+// steps with no key held, like when the game is paused. Used to resume a
+// game after quitting or a crash, and as starting positions of benchmarks.
+//
+// File format, little endian:
+//   header: magic, version, columns, rows, payload size, CRC-32 of the
+//     payload
+//   payload: seed, tick, the timers in microseconds, the handling, the auto
+//     shift, name, speed, score, lines, pieces, garbage, start time, the
+//     piece and its queue, the state of the generator, the type of every
+//     cell row by row
+namespace Snapshot {
+
+constexpr std::uint32_t MAGIC = 0x4e535454; // "TTSN"
+// 2 since pieces turn with SRS: the same orientation and position no longer
+// place the same blocks. 3 since the generator is a single word.
+constexpr std::uint16_t VERSION = 3;
+constexpr std::size_t HEADER_SIZE = 16;
+
+// For the variants of the game as well, see State. Loading fails when the
+// board was not of the same size.
+template <int Width, int Height>
+std::vector<unsigned char> encode(const State::Basic<Width, Height> &state);
+template <int Width, int Height>
+bool decode(const unsigned char *data, std::size_t size,
+            State::Basic<Width, Height> &state);
+
+// Written next to `path` first, then moved over it: a crash while saving
+// leaves the previous snapshot
+template <int Width, int Height>
+bool save(const State::Basic<Width, Height> &state, const std::string &path);
+// Checked and decoded from the file mapped in memory
+template <int Width, int Height>
+bool load(const std::string &path, State::Basic<Width, Height> &state);
+
+// Saves copies of the game on a background thread. A lost game removes the
+// file, there is nothing left to resume. Initialise in place, do not copy.
+struct Autosave {
+  std::string path;
+  std::thread writer;
+  std::mutex mutex;
+  std::condition_variable wake;
+  State::T pending;
+  bool hasPending = false;
+  bool running = false;
+  // Snapshots written, or file removed
+  std::size_t saves = 0;
+};
+
+bool start(Autosave &t, const std::string &path);
+
+bool isSaving(const Autosave &t);
+
+// Never allocates: a copy of the state is handed to the writer, at worst
+// once it took the previous one
+void request(Autosave &t, const State::T &state);
+
+// Writes what was requested last and waits for it
+void stop(Autosave &t);
+
+} // namespace Snapshot
+
+#endif // !SNAPSHOT_H
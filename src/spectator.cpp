@@ -0,0 +1,401 @@
+#include "spectator.h"
+#include "constants.h"
+#include "piece.h"
+#include "recorder.h"
+#include "state.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Spectator {
+
+using Recorder::getFixed;
+using Recorder::getVarint;
+using Recorder::putFixed;
+using Recorder::putVarint;
+
+constexpr auto WRITER_PERIOD = std::chrono::milliseconds(20);
+// How long stop waits for room for the end of the stream
+constexpr auto STOP_TIMEOUT = std::chrono::seconds(1);
+constexpr int ORIENTATION_BITS = 3;
+
+std::size_t putNibbles(const int *values, std::size_t count,
+                       unsigned char *out) {
+  std::size_t size = (count + 1) / 2;
+  std::memset(out, 0, size);
+  for (std::size_t i = 0; i < count; ++i) {
+    out[i / 2] |= std::uint8_t(values[i] << (4 * (i % 2)));
+  }
+  return size;
+}
+
+// Types of the cells, fails beyond `maxType`
+bool getNibbles(const unsigned char *data, std::size_t size,
+                std::size_t &position, std::size_t count, int maxType,
+                int *values) {
+  if (position + (count + 1) / 2 > size) {
+    return false;
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    values[i] = (data[position + i / 2] >> (4 * (i % 2))) & 0xf;
+    if (values[i] < 1 || values[i] > maxType) {
+      return false;
+    }
+  }
+  position += (count + 1) / 2;
+  return true;
+}
+
+std::size_t encodeHeader(unsigned char *out) {
+  std::size_t size = 0;
+  size += putFixed(MAGIC, 4, out + size);
+  size += putFixed(VERSION, 2, out + size);
+  out[size++] = NUMCOLS;
+  out[size++] = NUMROWS;
+  return size;
+}
+
+bool decodeHeader(const unsigned char *data, std::size_t size,
+                  std::size_t &position) {
+  std::uint64_t magic, version, columns, rows;
+  bool valid = getFixed(data, size, position, 4, magic) &&
+               getFixed(data, size, position, 2, version) &&
+               getFixed(data, size, position, 1, columns) &&
+               getFixed(data, size, position, 1, rows);
+  // The viewer draws the board of the game, not of its variants
+  return valid && magic == MAGIC && version == VERSION &&
+         columns == NUMCOLS && rows == NUMROWS;
+}
+
+std::size_t encodeRow(const Shown &shown, int row, unsigned char *out) {
+  std::size_t size = 0;
+  out[size++] = std::uint8_t(row);
+  size += putVarint(shown.board.rows[row], out + size);
+  int types[NUMCOLS];
+  std::size_t count = 0;
+  for (int type : shown.board.cells[row]) {
+    if (type != 0) {
+      types[count++] = type;
+    }
+  }
+  return size + putNibbles(types, count, out + size);
+}
+
+std::size_t encode(Shown &shown, const State::T &state, std::uint64_t step,
+                   bool isKeyFrame, unsigned char *out) {
+  const Piece::T &piece = state.piece;
+  Board::Rows changed = 0;
+  for (int row = 0; row < NUMROWS; ++row) {
+    if (isKeyFrame || state.board.cells[row] != shown.board.cells[row]) {
+      changed |= Board::Rows(1) << row;
+    }
+  }
+
+  std::uint8_t parts = 0;
+  if (changed != 0) {
+    parts |= ROWS;
+  }
+  if (isKeyFrame || piece.position != shown.position ||
+      piece.orientation != shown.orientation || piece.type != shown.type) {
+    parts |= PIECE;
+  }
+  if (isKeyFrame || piece.next != shown.next) {
+    parts |= NEXT;
+  }
+  if (isKeyFrame || state.score != shown.score ||
+      state.lines != shown.lines || state.pieces != shown.pieces) {
+    parts |= SCORE;
+  }
+  if (parts == 0) {
+    return 0;
+  }
+
+  std::size_t size = putVarint(step - shown.step, out);
+  out[size++] = parts;
+  shown.board = state.board;
+  shown.step = step;
+
+  if (parts & ROWS) {
+    out[size++] = std::uint8_t(std::popcount(changed));
+    for (; changed != 0; changed &= changed - 1) {
+      size += encodeRow(shown, std::countr_zero(changed), out + size);
+    }
+  }
+  if (parts & PIECE) {
+    shown.position = piece.position;
+    shown.orientation = piece.orientation;
+    shown.type = piece.type;
+    out[size++] = std::uint8_t(std::int8_t(piece.position.x));
+    out[size++] = std::uint8_t(std::int8_t(piece.position.y));
+    out[size++] =
+        std::uint8_t(piece.orientation | piece.type << ORIENTATION_BITS);
+  }
+  if (parts & NEXT) {
+    shown.next = piece.next;
+    size += putNibbles(piece.next.data(), piece.next.size(), out + size);
+  }
+  if (parts & SCORE) {
+    shown.score = state.score;
+    shown.lines = state.lines;
+    shown.pieces = state.pieces;
+    size += putVarint(std::uint32_t(state.score), out + size);
+    size += putVarint(std::uint32_t(state.lines), out + size);
+    size += putVarint(std::uint32_t(state.pieces), out + size);
+  }
+  return size;
+}
+
+std::size_t encodeEnd(Shown &shown, std::uint64_t step, unsigned char *out) {
+  std::size_t size = putVarint(step - shown.step, out);
+  out[size++] = END;
+  shown.step = step;
+  shown.isOver = true;
+  return size;
+}
+
+bool decodeRow(const unsigned char *data, std::size_t size,
+               std::size_t &position, Shown &shown) {
+  using Grid = decltype(shown.board);
+  std::uint64_t mask;
+  if (position >= size) {
+    return false;
+  }
+  int row = data[position++];
+  if (row >= NUMROWS || !getVarint(data, size, position, mask) ||
+      (mask & ~std::uint64_t(Grid::FULL_ROW)) != 0) {
+    return false;
+  }
+  int types[NUMCOLS];
+  if (!getNibbles(data, size, position, std::popcount(mask), Piece::GARBAGE,
+                  types)) {
+    return false;
+  }
+
+  shown.board.rows[row] = Grid::Row(mask);
+  int block = 0;
+  for (int col = 0; col < NUMCOLS; ++col) {
+    bool isSet = mask & (std::uint64_t(1) << col);
+    shown.board.cells[row][col] = std::uint8_t(isSet ? types[block++] : 0);
+  }
+  return true;
+}
+
+bool decode(const unsigned char *data, std::size_t size,
+            std::size_t &position, Shown &shown) {
+  // Applied to a copy, kept when the whole frame is there
+  Shown next = shown;
+  std::size_t at = position;
+  std::uint64_t delta;
+  if (!getVarint(data, size, at, delta) || at >= size) {
+    return false;
+  }
+  next.step += delta;
+  std::uint8_t parts = data[at++];
+
+  if (parts & ROWS) {
+    if (at >= size) {
+      return false;
+    }
+    int count = data[at++];
+    for (int i = 0; i < count; ++i) {
+      if (!decodeRow(data, size, at, next)) {
+        return false;
+      }
+    }
+  }
+  if (parts & PIECE) {
+    if (at + 3 > size) {
+      return false;
+    }
+    next.position.x = std::int8_t(data[at++]);
+    next.position.y = std::int8_t(data[at++]);
+    next.orientation = data[at] & ((1 << ORIENTATION_BITS) - 1);
+    next.type = data[at++] >> ORIENTATION_BITS;
+    if (next.orientation < 1 || next.orientation > 4 || next.type < 1 ||
+        next.type >= Piece::GARBAGE) {
+      return false;
+    }
+  }
+  if (parts & NEXT) {
+    if (!getNibbles(data, size, at, next.next.size(), Piece::GARBAGE - 1,
+                    next.next.data())) {
+      return false;
+    }
+  }
+  if (parts & SCORE) {
+    std::uint64_t score, lines, pieces;
+    if (!getVarint(data, size, at, score) ||
+        !getVarint(data, size, at, lines) ||
+        !getVarint(data, size, at, pieces)) {
+      return false;
+    }
+    next.score = int(score);
+    next.lines = int(lines);
+    next.pieces = int(pieces);
+  }
+  if (parts & END) {
+    next.isOver = true;
+  }
+
+  shown = next;
+  position = at;
+  return true;
+}
+
+// Appends a whole frame, or nothing when there is no room for it
+bool pushBytes(T &t, const unsigned char *data, std::size_t size) {
+  std::size_t write = t.write.load(std::memory_order_relaxed);
+  if (CAPACITY - (write - t.read.load(std::memory_order_acquire)) < size) {
+    return false;
+  }
+  std::size_t at = write % CAPACITY;
+  std::size_t first = std::min(size, CAPACITY - at);
+  std::memcpy(&t.bytes[at], data, first);
+  std::memcpy(&t.bytes[0], data + first, size - first);
+  t.write.store(write + size, std::memory_order_release);
+  return true;
+}
+
+// Bytes written, -1 once the stream is closed. Does not block where the
+// stream can be made non-blocking: a viewer that stops reading fills the
+// ring and the game drops frames.
+long writeSome(std::FILE *file, const unsigned char *data, std::size_t size) {
+#ifdef _WIN32
+  std::size_t written = std::fwrite(data, 1, size, file);
+  std::fflush(file);
+  return std::ferror(file) ? -1 : long(written);
+#else
+  ssize_t written = ::write(fileno(file), data, size);
+  if (written >= 0) {
+    return long(written);
+  }
+  return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? 0 : -1;
+#endif
+}
+
+void drain(T &t, bool &isFailed) {
+  std::size_t read = t.read.load(std::memory_order_relaxed);
+  std::size_t write = t.write.load(std::memory_order_acquire);
+  // Written as soon as possible for the viewers to follow live, what does
+  // not fit in the stream waits for the next round
+  while (read != write && !isFailed) {
+    std::size_t at = read % CAPACITY;
+    std::size_t size = std::min(write - read, CAPACITY - at);
+    long written = writeSome(t.file, &t.bytes[at], size);
+    if (written < 0) {
+      // The viewer left, the game goes on
+      std::cerr << "Spectator stream closed" << std::endl;
+      isFailed = true;
+    } else if (written == 0) {
+      break;
+    }
+    read += written > 0 ? std::size_t(written) : 0;
+  }
+  t.read.store(isFailed ? write : read, std::memory_order_release);
+}
+
+void writeLoop(T &t) {
+  bool isFailed = false;
+  while (t.running) {
+    drain(t, isFailed);
+    std::this_thread::sleep_for(WRITER_PERIOD);
+  }
+  // What is left, as long as the viewer takes it
+  auto deadline = std::chrono::steady_clock::now() + STOP_TIMEOUT;
+  drain(t, isFailed);
+  while (!isFailed && t.read != t.write &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(WRITER_PERIOD);
+    drain(t, isFailed);
+  }
+  std::fclose(t.file);
+  t.file = nullptr;
+}
+
+bool start(T &t, const std::string &path) {
+  if (isStreaming(t) || path == "-") {
+    return false;
+  }
+#ifdef SIGPIPE
+  // A viewer closing its end of a pipe must not end the game
+  std::signal(SIGPIPE, SIG_IGN);
+#endif
+  // Waits for a reader when it is a named pipe
+  t.file = std::fopen(path.c_str(), "wb");
+  if (t.file == nullptr) {
+    return false;
+  }
+
+  unsigned char buffer[MAX_SIZE];
+  std::fwrite(buffer, 1, encodeHeader(buffer), t.file);
+  std::fflush(t.file);
+#ifndef _WIN32
+  int fd = fileno(t.file);
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
+  t.read = 0;
+  t.write = 0;
+  t.shown = Shown{};
+  t.steps = 0;
+  t.isKeyFrame = true;
+  t.overflows = 0;
+  t.running = true;
+  t.writer = std::thread(writeLoop, std::ref(t));
+  return true;
+}
+
+bool isStreaming(const T &t) { return t.running; }
+
+void push(T &t, const State::T &state) {
+  if (!t.running) {
+    return;
+  }
+  t.steps += 1;
+  unsigned char buffer[MAX_SIZE];
+  // The step of a dropped frame never reaches the viewers, the next frame
+  // counts from the last one they got. It is a key frame, the rest of
+  // `shown` does not matter.
+  std::uint64_t sent = t.shown.step;
+  std::size_t size = encode(t.shown, state, t.steps, t.isKeyFrame, buffer);
+  if (size == 0) {
+    return;
+  }
+  t.isKeyFrame = !pushBytes(t, buffer, size);
+  if (t.isKeyFrame) {
+    t.shown.step = sent;
+    t.overflows += 1;
+  }
+}
+
+void stop(T &t) {
+  if (!t.running) {
+    return;
+  }
+  unsigned char buffer[MAX_SIZE];
+  std::size_t size = encodeEnd(t.shown, t.steps, buffer);
+  // Waits for room for the end a little, a viewer that stopped reading
+  // does not get it
+  auto deadline = std::chrono::steady_clock::now() + STOP_TIMEOUT;
+  while (!pushBytes(t, buffer, size) &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(WRITER_PERIOD);
+  }
+  t.running = false;
+  t.writer.join();
+}
+
+} // namespace Spectator
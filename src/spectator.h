@@ -0,0 +1,114 @@
+#ifndef SPECTATOR_H
+#define SPECTATOR_H
+
+#include "board.h"
+#include "constants.h"
+#include "piece.h"
+#include "state.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+// Streams a game to spectators, see src/viewer.cpp. Each step sends what
+// changed since the previous one: the rows, the pose of the piece, the queue
+// and the score. A quiet step sends nothing, a step moving the piece a few
+// bytes, so a game stays well under 1 KB/s.
+//
+// Stream format, little endian:
+//   header: magic, version, columns, rows
+//   then frames: step delta (varint), parts (byte) and for each part set
+//     - ROWS: count (byte), then for each row its index (byte), its mask
+//       (varint) and the type of each of its blocks, two per byte
+//     - PIECE: column, row (signed bytes), orientation and type (byte)
+//     - NEXT: the queue, two types per byte
+//     - SCORE: score, lines, pieces (varints)
+//     - END: nothing, the stream is over
+// A frame following dropped ones has every part and every row.
+namespace Spectator {
+
+constexpr std::uint32_t MAGIC = 0x50535454; // "TTSP"
+// 2 since pieces turn with SRS: the same orientation and position no longer
+// place the same blocks
+constexpr std::uint16_t VERSION = 2;
+// Bytes waiting for the writer thread, must be a power of two
+constexpr std::size_t CAPACITY = 16384;
+
+enum Part : std::uint8_t {
+  ROWS = 1,
+  PIECE = 2,
+  NEXT = 4,
+  SCORE = 8,
+  END = 16,
+};
+
+// The game as the spectators last saw it, on both ends of the stream
+struct Shown {
+  Board::T<NUMCOLS, NUMROWS> board;
+  sf::Vector2i position;
+  int orientation = 0;
+  int type = 0;
+  std::array<int, Piece::QUEUE_SIZE> next = {};
+  int score = 0;
+  int lines = 0;
+  int pieces = 0;
+  // Steps since the start of the stream
+  std::uint64_t step = 0;
+  bool isOver = false;
+};
+
+// The game thread encodes into a single producer single consumer ring of
+// bytes, a background thread writes them. Initialise in place, do not copy.
+struct T {
+  std::array<unsigned char, CAPACITY> bytes;
+  std::atomic<std::size_t> read = 0;
+  std::atomic<std::size_t> write = 0;
+  std::atomic<bool> running = false;
+  std::thread writer;
+  std::FILE *file = nullptr;
+  Shown shown;
+  // Steps pushed since the start
+  std::uint64_t steps = 0;
+  // Everything is sent with the next frame
+  bool isKeyFrame = true;
+  // Frames lost because the writer could not keep up
+  std::size_t overflows = 0;
+};
+
+// `path` is a file or a named pipe. Not the standard output, which the game
+// writes its reports to: a socket is reached through a named pipe, for
+// instance `mkfifo f; nc host port < f & tetris.exe --spectate=f`.
+bool start(T &t, const std::string &path);
+
+bool isStreaming(const T &t);
+
+// Once per step, sends what changed. Never blocks nor allocates.
+void push(T &t, const State::T &state);
+
+// Ends the stream and writes what the viewer takes. Returns within seconds
+// even when the viewer stopped reading, the end of the stream is then lost.
+void stop(T &t);
+
+// Encoding, shared with the viewer. Buffers must hold at least MAX_SIZE
+// bytes.
+constexpr std::size_t MAX_SIZE = 256;
+constexpr std::size_t HEADER_SIZE = 8;
+std::size_t encodeHeader(unsigned char *out);
+bool decodeHeader(const unsigned char *data, std::size_t size,
+                  std::size_t &position);
+// The frame from `shown` to `state` at `step`, 0 bytes when nothing changed.
+// `shown` becomes `state`.
+std::size_t encode(Shown &shown, const State::T &state, std::uint64_t step,
+                   bool isKeyFrame, unsigned char *out);
+std::size_t encodeEnd(Shown &shown, std::uint64_t step, unsigned char *out);
+// Applies the next frame to `shown`. Returns false, leaving both untouched,
+// when the frame is not complete yet or is invalid.
+bool decode(const unsigned char *data, std::size_t size,
+            std::size_t &position, Shown &shown);
+
+} // namespace Spectator
+
+#endif // !SPECTATOR_H
@@ -1,65 +1,95 @@
 #include "state.h"
-#include "blocks.h"
-#include "grid.h"
+#include "board.h"
 #include "keys.h"
 #include "piece.h"
+#include "profile.h"
 #include <algorithm>
+#include <bit>
 #include <iostream>
+#include <random>
 #include <sfml/graphics.hpp>
 
 namespace State {
 
-T init() {
-  auto origin = sf::Vector2f(OFFSET_GRID, OFFSET_GRID);
+template <typename U> U init(unsigned int seed) {
+  Piece::T piece = Piece::init(seed);
+  piece = Piece::set(piece, 1, 1, Piece::spawn(U::WIDTH));
 
-  Grid::T grid = Grid::init(origin);
-  Blocks::T blocks = Blocks::init(origin);
+  U t = U{};
+  t.piece = piece;
+  t.seed = seed;
+  return t;
+}
 
-  Piece::T piece = Piece::init(origin);
-  piece = Piece::set(piece, 1, 1, sf::Vector2f(5, 2));
+T init() {
+  std::random_device rd; // Obtain a random seed from the hardware
+  return init<T>(rd());
+}
 
-  return T{grid, blocks, piece};
+template <int Width, int Height>
+int level(const Basic<Width, Height> &t) {
+  return 1 + t.lines / LINES_PER_LEVEL;
 }
 
-void draw(T t, sf::RenderWindow &window) {
-  Grid::draw(t.grid, window);
-  Blocks::draw(t.blocks, window);
-  Piece::draw(t.piece, window);
+template <int Width, int Height>
+float piecesPerSecond(const Basic<Width, Height> &t) {
+  float played = (t.time - t.startTime).asSeconds();
+  return played > 0.f ? t.pieces / played : 0.f;
 }
 
-bool isPieceColliding(T t, Piece::T piece) {
-  for (const auto &newBlock : piece.blocks) {
-    if (newBlock.getPosition().x <= 0)
-      return true;
-    if (newBlock.getPosition().x > NUMCOLS * SQUARESIZE)
-      return true;
-    if (newBlock.getPosition().y > NUMROWS * SQUARESIZE)
-      return true;
+template <int Width, int Height>
+void draw(const Basic<Width, Height> &t, Render::T &target, sf::Vector2f origin,
+          float size) {
+  PROFILE_ZONE("State::draw");
+  Board::draw(t.board, target, origin, size);
+  Piece::draw(t.piece, target, origin, size);
+}
 
-    for (const auto &existingBlock : t.blocks.blocks) {
-      if (newBlock.getPosition() == existingBlock.getPosition()) {
-        return true;
-      }
+template <int Width, int Height>
+bool isPieceColliding(const Basic<Width, Height> &t, const Piece::T &piece) {
+  PROFILE_ZONE("State::isPieceColliding");
+  return Board::collides(t.board, piece.blocks);
+}
+
+// Number of free cells between the piece and the wall or the stack
+template <int Width, int Height>
+int distanceToWall(const Basic<Width, Height> &t, int direction) {
+  int distance = Width;
+  for (const auto &cell : t.piece.blocks) {
+    int free = 0;
+    for (int col = cell.x + direction;
+         col >= 0 && col < Width && !Board::isOccupied(t.board, col, cell.y);
+         col += direction) {
+      free += 1;
     }
+    distance = std::min(distance, free);
   }
-  return false;
+  return distance;
 }
 
-T rotate(T t, bool positive) {
+template <int Width, int Height>
+Basic<Width, Height> rotate(Basic<Width, Height> t, bool positive) {
   int offset = positive ? 1 : -1;
-  Piece::T newPiece = Piece::copyWithRotation(t.piece, offset);
-
-  if (isPieceColliding(t, newPiece)) {
+  int type = t.piece.type;
+  int orientation = Piece::turn(t.piece.orientation, offset);
+  const Piece::Kicks &kicks =
+      Piece::kicks(type, t.piece.orientation, offset);
+  int kick = Board::firstFit(t.board, Piece::footprint(type, orientation),
+                             t.piece.position, kicks);
+  if (kick < 0) {
     return t;
   }
 
-  t.piece = newPiece;
+  sf::Vector2i position =
+      t.piece.position + sf::Vector2i(kicks[kick].x, kicks[kick].y);
+  t.piece = Piece::set(t.piece, orientation, type, position);
+  t.events.rotated = true;
   return t;
 }
 
-T move(T t, const sf::Vector2f &direction) {
-  t.accumulatedFramesBeforeMove = 0.0f;
-
+template <int Width, int Height>
+Basic<Width, Height> move(Basic<Width, Height> t,
+                          const sf::Vector2i &direction) {
   Piece::T newPiece = Piece::copyWithOffset(t.piece, direction);
 
   if (isPieceColliding(t, newPiece)) {
@@ -67,68 +97,98 @@ T move(T t, const sf::Vector2f &direction) {
   }
 
   t.piece = newPiece;
+  t.events.moved = t.events.moved || direction.x != 0;
+  return t;
+}
+
+template <int Width, int Height>
+Basic<Width, Height> moveLeft(Basic<Width, Height> t) {
+  return move(t, sf::Vector2i(-1, 0));
+}
+template <int Width, int Height>
+Basic<Width, Height> moveRight(Basic<Width, Height> t) {
+  return move(t, sf::Vector2i(1, 0));
+}
+template <int Width, int Height>
+Basic<Width, Height> moveDown(Basic<Width, Height> t) {
+  return move(t, sf::Vector2i(0, 1));
+}
+
+template <int Width, int Height>
+Basic<Width, Height> shiftToWall(Basic<Width, Height> t, int direction) {
+  int distance = distanceToWall(t, direction);
+  if (distance == 0) {
+    return t;
+  }
+  t.piece =
+      Piece::copyWithOffset(t.piece, sf::Vector2i(direction * distance, 0));
+  t.events.moved = true;
   return t;
 }
 
-T moveLeft(T t) { return move(t, sf::Vector2f(-1, 0)); }
-T moveRight(T t) { return move(t, sf::Vector2f(1, 0)); }
-T moveDown(T t) { return move(t, sf::Vector2f(0, 1)); }
+template <int Width, int Height>
+Basic<Width, Height> withRemovedFullLines(Basic<Width, Height> t) {
+  PROFILE_ZONE("State::withRemovedFullLines");
+  Board::Rows fullRows = Board::fullRows(t.board);
+  t.board = Board::removeRows(t.board, fullRows);
+  t.events.clearedRows |= fullRows;
 
-T withRemovedFullLines(T t) {
-  auto &blocks = t.blocks.blocks;
+  int count = std::popcount(fullRows);
+  t.score += LINE_SCORES[std::min(count, 4)] * level(t);
+  t.lines += count;
 
-  std::sort(
-      blocks.begin(), blocks.end(),
-      [](const sf::RectangleShape &left, const sf::RectangleShape &right) {
-        return left.getPosition().y < right.getPosition().y;
-      });
+  return t;
+}
 
-  // 0 indexed
-  int count[NUMROWS] = {};
-  for (const auto &block : blocks) {
-    // 1 indexed
-    int y = int(block.getPosition().y / SQUARESIZE);
-    count[y - 1] += 1;
+template <int Width, int Height>
+Basic<Width, Height> lock(Basic<Width, Height> t) {
+  t.events.locked = true;
+  t.events.lockedColor = Piece::color(t.piece.type);
+  t.events.lockedBlocks = t.piece.blocks;
+
+  t.pieces += 1;
+  t.board = Board::add(t.board, t.piece.blocks, t.piece.type);
+  t.piece = Piece::reset(t.piece, Width);
+  t = withRemovedFullLines(t);
+  if (t.garbage > 0) {
+    t.board = Board::addGarbage(t.board, t.garbage, t.garbageHole);
+    t.garbage = 0;
   }
 
-  int currentOffset = 0;
-  int numberOfTimesLinesShouldBeShifted[NUMROWS] = {};
-  for (int i = 0; i < NUMROWS; ++i) {
-    // Start from the end
-    // 0 indexed
-    int y = NUMROWS - i;
-    if (count[y] == NUMCOLS) {
-      currentOffset += 1;
-    }
-    numberOfTimesLinesShouldBeShifted[y] = currentOffset;
+  // Game over when the next piece has no room once the lines are cleared
+  if (isPieceColliding(t, t.piece)) {
+    t.name = LOST;
+    t.events.lost = true;
   }
+  return t;
+}
 
-  std::vector<sf::RectangleShape> shiftedBlocks;
-  for (auto block : blocks) {
-    // 1 indexed
-    int y = int(block.getPosition().y / SQUARESIZE);
-    if (count[y - 1] == NUMCOLS) {
-      continue;
-    }
-    block.setPosition(block.getPosition().x,
-                      block.getPosition().y +
-                          numberOfTimesLinesShouldBeShifted[y] * SQUARESIZE);
-    shiftedBlocks.push_back(block);
-  }
+template <int Width, int Height>
+Basic<Width, Height> hardDrop(Basic<Width, Height> t) {
+  int distance = 0;
+  Piece::T newPiece = Piece::copyWithOffset(t.piece, sf::Vector2i(0, 1));
 
-  t.blocks.blocks = shiftedBlocks;
+  while (!isPieceColliding(t, newPiece)) {
+    t.piece = newPiece;
+    newPiece = Piece::copyWithOffset(t.piece, sf::Vector2i(0, 1));
+    distance += 1;
+  }
 
-  return t;
+  t.events.hardDropped = true;
+  t.events.hardDropDistance = distance;
+  t.score += HARD_DROP_SCORE * distance;
+  t.sinceFall = sf::Time::Zero;
+  return lock(t);
 }
 
-T update(T t, bool shouldAutomaticallyFall) {
-  Piece::T current = t.piece;
-  Piece::T newPiece = Piece::copyWithOffset(t.piece, sf::Vector2f(0, 1));
+template <int Width, int Height>
+Basic<Width, Height> update(Basic<Width, Height> t,
+                            bool shouldAutomaticallyFall) {
+  PROFILE_ZONE("State::update");
+  Piece::T newPiece = Piece::copyWithOffset(t.piece, sf::Vector2i(0, 1));
 
   if (isPieceColliding(t, newPiece)) {
-    t.blocks = Blocks::addBlocks(t.blocks, current.blocks);
-    t.piece = Piece::reset(current);
-    return withRemovedFullLines(t);
+    return lock(t);
   }
 
   if (shouldAutomaticallyFall) {
@@ -138,56 +198,180 @@ T update(T t, bool shouldAutomaticallyFall) {
   return t;
 }
 
-T manageKeyPressed(T t, sf::Keyboard::Key key, bool wasJustPressed) {
+template <int Width, int Height>
+Basic<Width, Height> startShift(Basic<Width, Height> t, int direction,
+                                sf::Time time) {
+  t.shiftDirection = direction;
+  t.shiftPressedAt = time;
+  t.shiftRepeats = 0;
+  return move(t, sf::Vector2i(direction, 0));
+}
+
+template <int Width, int Height>
+Basic<Width, Height> react(Basic<Width, Height> t, sf::Keyboard::Key key,
+                           bool wasJustPressed, sf::Time time) {
   if (key == sf::Keyboard::Space && wasJustPressed) {
     return rotate(t, true);
   }
 
-  if (key == sf::Keyboard::Left) {
-    return moveLeft(t);
+  if (key == sf::Keyboard::Z && wasJustPressed) {
+    return rotate(t, false);
+  }
+
+  if (key == sf::Keyboard::Up && wasJustPressed) {
+    return hardDrop(t);
   }
 
-  if (key == sf::Keyboard::Right) {
-    return moveRight(t);
+  if (key == sf::Keyboard::Left && wasJustPressed) {
+    return startShift(t, -1, time);
   }
 
-  if (key == sf::Keyboard::Down) {
-    t.accumulatedFramesBeforeFall = 0.f;
-    return moveDown(t);
+  if (key == sf::Keyboard::Right && wasJustPressed) {
+    return startShift(t, +1, time);
+  }
+
+  if (key == sf::Keyboard::Down && wasJustPressed) {
+    t.sinceFall = sf::Time::Zero;
+    sf::Vector2i position = t.piece.position;
+    t = moveDown(t);
+    if (t.piece.position != position) {
+      t.score += SOFT_DROP_SCORE;
+    }
+    return t;
   }
 
   return t;
 }
 
-T manageFixedStep(T t, Keys::T keys) {
-  float FramesBeforeFall = fixedNumberOfFrames / t.speed;
-  // If you keep the key pressed, it will move the piece 1.5f times per update
-  float FramesBeforeMovement = std::max(FramesBeforeFall / 2.f, 7.5f);
+template <int Width, int Height>
+Basic<Width, Height> manageKeyPressed(Basic<Width, Height> t,
+                                      sf::Keyboard::Key key,
+                                      bool wasJustPressed, sf::Time time,
+                                      sf::Time timestamp) {
+  sf::Vector2i position = t.piece.position;
+  int orientation = t.piece.orientation;
+  int pieces = t.pieces;
+
+  t = react(t, key, wasJustPressed, time);
+
+  bool changed = t.piece.position != position ||
+                 t.piece.orientation != orientation || t.pieces != pieces;
+  if (changed && t.inputTimestamp == sf::Time::Zero) {
+    t.inputTimestamp = timestamp;
+  }
+  return t;
+}
+
+// Repeats are scheduled from the exact time of the key press, so several
+// of them can happen in the same step when the ARR is shorter than a step
+template <int Width, int Height>
+Basic<Width, Height> autoShift(Basic<Width, Height> t, const Keys::T &keys) {
+  if (t.shiftDirection == 0) {
+    return t;
+  }
 
-  t.accumulatedFramesBeforeMove += 1.0f;
-  t.accumulatedFramesBeforeFall += 1.0f;
-  t.accumulatedFramesBeforeUpdate += 1.0f;
+  auto key = t.shiftDirection < 0 ? sf::Keyboard::Left : sf::Keyboard::Right;
+  if (!Keys::isAlreadyPressed(keys, key)) {
+    t.shiftDirection = 0;
+    return t;
+  }
 
-  if (t.accumulatedFramesBeforeMove >= FramesBeforeMovement) {
-    for (const auto &key : keys.pressed) {
-      t = manageKeyPressed(t, key, false);
-    }
+  sf::Time held = t.time - t.shiftPressedAt;
+  if (held < t.handling.das) {
+    return t;
   }
 
-  if (t.accumulatedFramesBeforeUpdate >= FramesBeforeFall) {
-    bool shouldAutomaticallyFall =
-        t.accumulatedFramesBeforeFall >= FramesBeforeFall;
+  if (t.handling.arr == sf::Time::Zero) {
+    return shiftToWall(t, t.shiftDirection);
+  }
+
+  int due = 1 + (held - t.handling.das).asMicroseconds() /
+                    t.handling.arr.asMicroseconds();
+  for (; t.shiftRepeats < due; ++t.shiftRepeats) {
+    t = move(t, sf::Vector2i(t.shiftDirection, 0));
+  }
+  return t;
+}
+
+// Time for the piece to fall by one row
+template <int Width, int Height>
+sf::Time fallInterval(const Basic<Width, Height> &t, bool isSoftDropping) {
+  float rowsPerSecond = t.speed + SPEED_PER_LEVEL * (level(t) - 1);
+  if (isSoftDropping) {
+    rowsPerSecond *= t.handling.softDropFactor;
+  }
+  return sf::seconds(1.f / rowsPerSecond);
+}
+
+template <int Width, int Height>
+Basic<Width, Height> manageFixedStep(Basic<Width, Height> t,
+                                     const Keys::T &keys) {
+  PROFILE_ZONE("State::manageFixedStep");
+  bool isSoftDropping = Keys::isAlreadyPressed(keys, sf::Keyboard::Down);
+  sf::Time interval = fallInterval(t, isSoftDropping);
+
+  t.tick += 1;
+  t.time += fixedStep;
+  t.sinceFall += fixedStep;
+  t.sinceUpdate += fixedStep;
+
+  t = autoShift(t, keys);
+
+  if (t.sinceUpdate >= interval) {
+    bool shouldAutomaticallyFall = t.sinceFall >= interval;
+    sf::Vector2i position = t.piece.position;
 
     t = State::update(t, shouldAutomaticallyFall);
 
     if (shouldAutomaticallyFall) {
-      t.accumulatedFramesBeforeFall = 0.0f;
+      t.sinceFall = sf::Time::Zero;
+      if (isSoftDropping && t.piece.position.y > position.y) {
+        t.score += SOFT_DROP_SCORE;
+      }
     }
 
-    t.accumulatedFramesBeforeUpdate = 0.0f;
+    t.sinceUpdate = sf::Time::Zero;
   }
 
   return t;
 }
 
+template <int Width, int Height>
+Basic<Width, Height> step(Basic<Width, Height> t, Keys::T &keys) {
+  sf::Time end = t.time + fixedStep;
+  Keys::Event input;
+  while (t.name != LOST && Keys::pop(keys, end, input)) {
+    if (input.pressed) {
+      t = manageKeyPressed(t, input.key, true, input.time, input.timestamp);
+    }
+  }
+  if (t.name != LOST) {
+    return manageFixedStep(t, keys);
+  }
+
+  // Nothing moves once the game is over, the step still counts
+  t.tick += 1;
+  t.time = end;
+  return t;
+}
+
+// Every variant of the game is compiled here
+#define INSTANTIATE(U)                                                         \
+  template U init<U>(unsigned int);                                            \
+  template int level(const U &);                                               \
+  template float piecesPerSecond(const U &);                                   \
+  template void draw(const U &, Render::T &, sf::Vector2f, float);             \
+  template U rotate(U, bool);                                                  \
+  template U hardDrop(U);                                                      \
+  template U withRemovedFullLines(U);                                          \
+  template U update(U, bool);                                                  \
+  template U manageKeyPressed(U, sf::Keyboard::Key, bool, sf::Time, sf::Time); \
+  template U manageFixedStep(U, const Keys::T &);                              \
+  template U step(U, Keys::T &);
+
+INSTANTIATE(T)
+INSTANTIATE(Drill)
+INSTANTIATE(Marathon)
+INSTANTIATE(Party)
+
 } // namespace State
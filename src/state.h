@@ -1,59 +1,154 @@
 #ifndef STATE_H
 #define STATE_H
 
-#include "blocks.h"
-#include "grid.h"
+#include "board.h"
+#include "constants.h"
 #include "keys.h"
 #include "piece.h"
+#include "render.h"
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
 
 namespace State {
 
+constexpr int LINES_PER_LEVEL = 10;
+// Indexed by the number of lines cleared at once, multiplied by the level
+constexpr int LINE_SCORES[] = {0, 100, 300, 500, 800};
+constexpr int SOFT_DROP_SCORE = 1;
+constexpr int HARD_DROP_SCORE = 2;
+// Each level makes the pieces fall that much faster
+constexpr float SPEED_PER_LEVEL = 0.5f;
+
 enum Name {
   SHOWING_FIRST_MENU,
   PLAYING,
+  PAUSED,
   LOST,
   WON,
 };
 
-struct T {
-  // show menu, select with keys and validate with enter
-  // make selected item blink with fixed step
-  // - Start
-  // - Difficulty
-
-  // Menu:
-  // - Resume
-  // - Restart
-  // - Change difficulty
+// What happened to the board, consumed by the effects after each step
+struct Events {
+  // One bit per cleared row, 0 is the top of the grid
+  Board::Rows clearedRows = 0;
+  bool locked = false;
+  Piece::Cells lockedBlocks = {};
+  sf::Color lockedColor;
+  bool hardDropped = false;
+  int hardDropDistance = 0;
+  // Sideways, by one cell or to the wall
+  bool moved = false;
+  bool rotated = false;
+  // The next piece had no room, the state is LOST
+  bool lost = false;
+};
 
-  // Lose progress warning
+// Tunable by the player
+struct Handling {
+  // Delayed auto shift: how long left or right must be held before repeating
+  sf::Time das = sf::milliseconds(167);
+  // Auto repeat rate: time between two repeated moves, zero goes to the wall
+  sf::Time arr = sf::milliseconds(33);
+  // How many times faster pieces fall while down is held
+  float softDropFactor = 20.f;
+};
 
-  // Show score
-  // Show next piece
+// The rules are the same on every board, variants only change its size
+template <int Width, int Height> struct Basic {
+  static constexpr int WIDTH = Width;
+  static constexpr int HEIGHT = Height;
 
-  Grid::T grid;
-  Blocks::T blocks;
+  Board::T<Width, Height> board;
   Piece::T piece;
 
-  float accumulatedFramesBeforeFall = 0.0f;
-  float accumulatedFramesBeforeMove = 0.0f;
-  float accumulatedFramesBeforeUpdate = 0.0f;
+  // Simulation time since the piece last fell, and since it was last checked
+  // for a fall. The piece locks when it cannot fall at a check, so the lock
+  // delay is the fall interval.
+  sf::Time sinceFall = sf::Time::Zero;
+  sf::Time sinceUpdate = sf::Time::Zero;
+
+  unsigned int seed = 0;
+  // Number of fixed steps and simulation time, advanced by every step
+  std::uint64_t tick = 0;
+  sf::Time time = sf::Time::Zero;
+  // Simulation time when the game started, the played time runs from there
+  sf::Time startTime = sf::Time::Zero;
+  Handling handling;
+  // -1 while left is auto shifting, +1 for right, 0 otherwise
+  int shiftDirection = 0;
+  sf::Time shiftPressedAt = sf::Time::Zero;
+  int shiftRepeats = 0;
 
   Name name = SHOWING_FIRST_MENU;
   float speed = 1.0f;
+
+  int score = 0;
+  int lines = 0;
+  int pieces = 0;
+  // Rows sent by an opponent, pushed up with a hole in `garbageHole` at the
+  // next lock
+  int garbage = 0;
+  int garbageHole = 0;
+
+  Events events;
+  // When the oldest input changing the state not displayed yet was received,
+  // zero if there is none
+  sf::Time inputTimestamp = sf::Time::Zero;
 };
 
+// The game, and its variants instantiated in state.cpp
+using T = Basic<NUMCOLS, NUMROWS>;
+// Practice of the line piece in a well
+using Drill = Basic<4, NUMROWS>;
+using Marathon = Basic<NUMCOLS, 40>;
+// For several players side by side
+using Party = Basic<24, NUMROWS>;
+
+// The seed decides the sequence of pieces, the same seed and the same
+// input give the same game
+template <typename U = T> U init(unsigned int seed);
 T init();
 
-void draw(T t, sf::RenderWindow &window);
-
-T rotate(T t, bool positive);
-
-T update(T t, bool shouldAutomaticallyFall);
-
-T manageKeyPressed(T t, sf::Keyboard::Key key, bool wasJustPressed);
-T manageFixedStep(T t, Keys::T keys);
+template <int Width, int Height> int level(const Basic<Width, Height> &t);
+template <int Width, int Height>
+float piecesPerSecond(const Basic<Width, Height> &t);
+
+// `origin` is the top left corner of the grid and `size` the side of a cell,
+// in pixels
+template <int Width, int Height>
+void draw(const Basic<Width, Height> &t, Render::T &target,
+          sf::Vector2f origin = GRID_ORIGIN, float size = SQUARESIZE);
+
+// Clockwise when `positive`, with the kicks of Piece when the turned piece
+// does not fit where it is. Space turns clockwise and Z the other way.
+template <int Width, int Height>
+Basic<Width, Height> rotate(Basic<Width, Height> t, bool positive);
+
+template <int Width, int Height>
+Basic<Width, Height> hardDrop(Basic<Width, Height> t);
+
+template <int Width, int Height>
+Basic<Width, Height> withRemovedFullLines(Basic<Width, Height> t);
+
+template <int Width, int Height>
+Basic<Width, Height> update(Basic<Width, Height> t,
+                            bool shouldAutomaticallyFall);
+
+// `time` is when the key was pressed in simulation time, possibly between
+// two fixed steps. `timestamp` is for latency measurements.
+template <int Width, int Height>
+Basic<Width, Height> manageKeyPressed(Basic<Width, Height> t,
+                                      sf::Keyboard::Key key,
+                                      bool wasJustPressed, sf::Time time,
+                                      sf::Time timestamp = sf::Time::Zero);
+template <int Width, int Height>
+Basic<Width, Height> manageFixedStep(Basic<Width, Height> t,
+                                     const Keys::T &keys);
+
+// Applies the input received before the end of the step, then steps
+template <int Width, int Height>
+Basic<Width, Height> step(Basic<Width, Height> t, Keys::T &keys);
 
 } // namespace State
 
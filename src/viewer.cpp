@@ -0,0 +1,186 @@
+#include "constants.h"
+#include "grid.h"
+#include "hud.h"
+#include "loader.h"
+#include "render.h"
+#include "scheduler.h"
+#include "spectator.h"
+#include "state.h"
+
+#include <SFML/Graphics.hpp>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// Watches a game streamed with --spectate, see Spectator. Frames are shown
+// at the pace they were played, or as soon as they arrive when following a
+// game live.
+// Usage: tetris_viewer [PATH], the standard input by default. Live, through
+// a named pipe:
+//   mkfifo /tmp/tetris.fifo
+//   tetris_viewer /tmp/tetris.fifo & tetris.exe --spectate=/tmp/tetris.fifo
+
+namespace {
+
+constexpr std::size_t READ_SIZE = 4096;
+// Consumed bytes are dropped from the buffer past that
+constexpr std::size_t COMPACT_SIZE = 64 * 1024;
+
+// Never blocks: a pipe without a writer yet reads as empty
+int open(const std::string &path) {
+  if (path == "-") {
+    int flags = fcntl(STDIN_FILENO, F_GETFL, 0);
+    fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
+    return STDIN_FILENO;
+  }
+  return ::open(path.c_str(), O_RDONLY | O_NONBLOCK);
+}
+
+// Appends what arrived since the last call
+void receive(int fd, std::vector<unsigned char> &stream) {
+  unsigned char buffer[READ_SIZE];
+  ssize_t count;
+  while ((count = read(fd, buffer, READ_SIZE)) > 0) {
+    stream.insert(stream.end(), buffer, buffer + count);
+  }
+}
+
+struct Viewer {
+  std::vector<unsigned char> stream;
+  std::size_t position = 0;
+  bool hasHeader = false;
+  Spectator::Shown shown;
+  // Steps played back since the header, frames up to it are shown
+  std::uint64_t step = 0;
+  // When the current game started, for the pieces per second
+  std::uint64_t gameStart = 0;
+  State::T state = State::init(0);
+};
+
+// Applies the frames that are due, false when the stream is not one
+bool update(Viewer &t) {
+  if (!t.hasHeader) {
+    std::size_t position = 0;
+    if (t.stream.size() < Spectator::HEADER_SIZE) {
+      return true;
+    }
+    if (!Spectator::decodeHeader(t.stream.data(), t.stream.size(),
+                                 position)) {
+      return false;
+    }
+    t.position = position;
+    t.hasHeader = true;
+  }
+
+  Spectator::Shown next = t.shown;
+  std::size_t position = t.position;
+  while (Spectator::decode(t.stream.data(), t.stream.size(), position,
+                           next) &&
+         next.step <= t.step) {
+    if (next.pieces < t.shown.pieces) {
+      t.gameStart = next.step;
+    }
+    t.shown = next;
+    t.position = position;
+  }
+
+  if (t.position > COMPACT_SIZE) {
+    t.stream.erase(t.stream.begin(), t.stream.begin() + t.position);
+    t.position = 0;
+  }
+
+  State::T &state = t.state;
+  state.board = t.shown.board;
+  if (t.shown.type != 0) {
+    state.piece = Piece::set(state.piece, t.shown.orientation, t.shown.type,
+                             t.shown.position);
+    state.piece.next = t.shown.next;
+  }
+  state.score = t.shown.score;
+  state.lines = t.shown.lines;
+  state.pieces = t.shown.pieces;
+  state.time = fixedStep * sf::Int64(t.shown.step);
+  state.startTime = fixedStep * sf::Int64(t.gameStart);
+  return true;
+}
+
+void draw(const Viewer &t, const Grid::T &grid, Render::T &target) {
+  Grid::draw(grid, target);
+  // Nothing falls before the first frame
+  if (t.shown.type != 0) {
+    State::draw(t.state, target);
+  } else {
+    Board::draw(t.state.board, target, GRID_ORIGIN, SQUARESIZE);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string path = argc > 1 ? argv[1] : "-";
+  int fd = open(path);
+  if (fd < 0) {
+    std::cerr << "Cannot open " << path << ": " << std::strerror(errno)
+              << std::endl;
+    return 1;
+  }
+
+  Loader::T loader;
+  Loader::start(loader);
+  sf::VideoMode videoMode = sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT);
+  sf::RenderWindow window(videoMode, "Tetris (spectating)");
+  Scheduler::T scheduler = Scheduler::init(Scheduler::PRECISE_SLEEP);
+  Scheduler::apply(scheduler, window);
+  Render::T target = Render::init(window);
+  Grid::T grid = Grid::init(GRID_ORIGIN);
+  Loader::wait(loader);
+  Hud::T hud;
+  Hud::init(hud, loader.font, HUD_ORIGIN);
+
+  Viewer viewer;
+  sf::Clock clock;
+  sf::Time accumulatedTime = sf::Time::Zero;
+
+  while (window.isOpen()) {
+    sf::Event event;
+    while (window.pollEvent(event)) {
+      if (event.type == sf::Event::Closed ||
+          (event.type == sf::Event::KeyPressed &&
+           event.key.code == sf::Keyboard::Escape)) {
+        window.close();
+      }
+    }
+
+    receive(fd, viewer.stream);
+    // Played back from the header on, a live game is never behind
+    accumulatedTime += clock.restart();
+    if (!viewer.hasHeader) {
+      accumulatedTime = sf::Time::Zero;
+    }
+    for (; accumulatedTime >= fixedStep; accumulatedTime -= fixedStep) {
+      viewer.step += 1;
+    }
+    if (!update(viewer)) {
+      std::cerr << path << " is not a spectator stream" << std::endl;
+      break;
+    }
+
+    window.clear(COLOR_BACKGROUND);
+    draw(viewer, grid, target);
+    Hud::update(hud, viewer.state);
+    Hud::draw(hud, target);
+    window.display();
+    Render::endFrame(target);
+    Scheduler::endFrame(scheduler);
+  }
+
+  if (fd != STDIN_FILENO) {
+    close(fd);
+  }
+  return 0;
+}
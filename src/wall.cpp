@@ -0,0 +1,247 @@
+#include "wall.h"
+#include "bot.h"
+#include "constants.h"
+#include "grid.h"
+#include "pool.h"
+#include "profile.h"
+#include "render.h"
+#include "scheduler.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <random>
+
+namespace Wall {
+
+struct Binding {
+  sf::Keyboard::Key left;
+  sf::Keyboard::Key right;
+  sf::Keyboard::Key softDrop;
+  sf::Keyboard::Key hardDrop;
+  sf::Keyboard::Key rotate;
+  sf::Keyboard::Key counterRotate;
+};
+
+// The keys of the game, and letters for the player on the left in versus
+constexpr Binding ARROWS = {sf::Keyboard::Left, sf::Keyboard::Right,
+                            sf::Keyboard::Down, sf::Keyboard::Up,
+                            sf::Keyboard::Space, sf::Keyboard::Z};
+constexpr Binding LETTERS = {sf::Keyboard::A, sf::Keyboard::D,
+                             sf::Keyboard::S, sf::Keyboard::W,
+                             sf::Keyboard::Q, sf::Keyboard::E};
+
+Binding binding(const T &t, int player) {
+  return t.players == 2 && player == 0 ? LETTERS : ARROWS;
+}
+
+T init(int boards, int players, unsigned int seed, sf::Vector2f area) {
+  boards = std::clamp(boards, 1, MAX_BOARDS);
+  T t = T{};
+  t.pool = Pool::init(boards, seed);
+  t.players = std::clamp(players, 0, std::min(boards, MAX_PLAYERS));
+  t.plans.resize(boards);
+  t.plannedPieces.resize(boards, -1);
+  t.lostSteps.resize(boards);
+
+  // As many columns of boards as make them the largest, half a cell apart
+  int columns = 1;
+  for (int count = 1; count <= boards; ++count) {
+    int rows = (boards + count - 1) / count;
+    float size = std::min(area.x / (count * (NUMCOLS + 1)),
+                          area.y / (rows * (NUMROWS + 1)));
+    if (size > t.size) {
+      t.size = size;
+      columns = count;
+    }
+  }
+  for (int board = 0; board < boards; ++board) {
+    sf::Vector2f origin((board % columns) * (NUMCOLS + 1) * t.size,
+                        (board / columns) * (NUMROWS + 1) * t.size);
+    origin += sf::Vector2f(t.size / 2.f, t.size / 2.f);
+    t.origins.push_back(origin);
+    t.grids.push_back(Grid::init(origin, NUMCOLS, NUMROWS, t.size));
+  }
+  return t;
+}
+
+void handleEvent(T &t, const sf::Event &event) {
+  bool pressed = event.type == sf::Event::KeyPressed;
+  sf::Keyboard::Key key = event.key.code;
+  if ((!pressed && event.type != sf::Event::KeyReleased) || key < 0 ||
+      key >= sf::Keyboard::KeyCount) {
+    return;
+  }
+  // The key repeat of the system sends presses of a held key again
+  if (pressed && t.held[key]) {
+    return;
+  }
+  t.held[key] = pressed;
+
+  for (int player = 0; player < t.players; ++player) {
+    Binding keys = binding(t, player);
+    if (key == keys.softDrop) {
+      t.softDropping[player] = pressed;
+    }
+    if (key == keys.left || key == keys.right) {
+      int direction = key == keys.left ? -1 : 1;
+      if (pressed) {
+        t.shiftDirection[player] = direction;
+        t.shiftPressedAt[player] = t.time;
+        t.shiftRepeats[player] = 0;
+      } else if (t.shiftDirection[player] == direction) {
+        t.shiftDirection[player] = 0;
+      }
+    }
+    if (!pressed) {
+      continue;
+    }
+
+    std::uint8_t &input = t.pool.input[player];
+    if (key == keys.left) {
+      input |= Pool::LEFT;
+    } else if (key == keys.right) {
+      input |= Pool::RIGHT;
+    } else if (key == keys.rotate) {
+      input |= Pool::ROTATE;
+    } else if (key == keys.counterRotate) {
+      input |= Pool::COUNTER_ROTATE;
+    } else if (key == keys.hardDrop) {
+      input |= Pool::HARD_DROP;
+    }
+  }
+}
+
+// The repeated move of a player holding left or right, like
+// State::autoShift. The pool moves a piece by one cell per step, so repeats
+// due faster, or to the wall with a zero ARR, are one per step.
+std::uint8_t autoShift(T &t, int player) {
+  int direction = t.shiftDirection[player];
+  sf::Time held = t.time - t.shiftPressedAt[player];
+  if (direction == 0 || held < t.handling.das) {
+    return 0;
+  }
+
+  int due = t.shiftRepeats[player] + 1;
+  if (t.handling.arr != sf::Time::Zero) {
+    due = 1 + (held - t.handling.das).asMicroseconds() /
+                  t.handling.arr.asMicroseconds();
+  }
+  if (t.shiftRepeats[player] >= due) {
+    return 0;
+  }
+  t.shiftRepeats[player] = due;
+  return direction < 0 ? Pool::LEFT : Pool::RIGHT;
+}
+
+// One key per step: the rotations, the shifts, then the drop
+std::uint8_t think(T &t, int board) {
+  if (t.plannedPieces[board] != t.pool.pieces[board]) {
+    t.plans[board] = Bot::best(t.pool, board);
+    t.plannedPieces[board] = t.pool.pieces[board];
+  }
+
+  Bot::Move &plan = t.plans[board];
+  if (plan.rotations != 0) {
+    int direction = plan.rotations < 0 ? -1 : 1;
+    plan.rotations -= direction;
+    return direction < 0 ? Pool::COUNTER_ROTATE : Pool::ROTATE;
+  }
+  if (plan.shift != 0) {
+    int direction = plan.shift < 0 ? -1 : 1;
+    plan.shift -= direction;
+    return direction < 0 ? Pool::LEFT : Pool::RIGHT;
+  }
+  return Pool::HARD_DROP;
+}
+
+void step(T &t) {
+  PROFILE_ZONE("Wall::step");
+  Pool::T &pool = t.pool;
+  t.time += fixedStep;
+  for (int player = 0; player < t.players; ++player) {
+    if (t.softDropping[player]) {
+      pool.input[player] |= Pool::SOFT_DROP;
+    }
+    pool.input[player] |= autoShift(t, player);
+  }
+  for (int board = t.players; board < pool.count; ++board) {
+    if (!pool.lost[board]) {
+      pool.input[board] = think(t, board);
+    }
+  }
+
+  Pool::step(pool);
+
+  for (int board = 0; board < pool.count; ++board) {
+    // Every line but the first is sent, to the next board
+    if (pool.cleared[board] > 1) {
+      std::uint8_t &garbage = pool.garbage[(board + 1) % pool.count];
+      garbage = std::uint8_t(std::min(garbage + pool.cleared[board] - 1,
+                                      NUMROWS));
+    }
+    if (!pool.lost[board]) {
+      continue;
+    }
+    t.lostSteps[board] += 1;
+    if (t.lostSteps[board] >= RESTART_STEPS) {
+      Pool::restart(pool, board);
+      t.lostSteps[board] = 0;
+      t.plannedPieces[board] = -1;
+      t.games += 1;
+    }
+  }
+}
+
+void draw(const T &t, Render::T &target) {
+  PROFILE_ZONE("Wall::draw");
+  for (int board = 0; board < t.pool.count; ++board) {
+    Grid::draw(t.grids[board], target);
+    Pool::draw(t.pool, board, target, t.origins[board], t.size);
+  }
+}
+
+int run(int boards, int players, State::Handling handling) {
+  sf::VideoMode videoMode = sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT);
+  sf::RenderWindow window(videoMode, "Tetris (SFML rocks!)");
+  Scheduler::T scheduler = Scheduler::init(Scheduler::PRECISE_SLEEP);
+  Scheduler::apply(scheduler, window);
+  Render::T target = Render::init(window);
+
+  std::random_device rd;
+  T t = init(boards, players, rd(), sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
+  t.handling = handling;
+  sf::Clock clock;
+  sf::Time accumulatedTime = sf::Time::Zero;
+
+  while (window.isOpen()) {
+    sf::Event event;
+    while (window.pollEvent(event)) {
+      if (event.type == sf::Event::Closed ||
+          (event.type == sf::Event::KeyPressed &&
+           event.key.code == sf::Keyboard::Escape)) {
+        window.close();
+      }
+      handleEvent(t, event);
+    }
+
+    // Like the game, late steps beyond maxStepsPerFrame are dropped
+    accumulatedTime += clock.restart();
+    for (int steps = 0; accumulatedTime >= fixedStep; ++steps) {
+      if (steps == maxStepsPerFrame) {
+        accumulatedTime = accumulatedTime % fixedStep;
+        break;
+      }
+      step(t);
+      accumulatedTime -= fixedStep;
+    }
+
+    window.clear(COLOR_BACKGROUND);
+    draw(t, target);
+    window.display();
+    Render::endFrame(target);
+    Scheduler::endFrame(scheduler);
+  }
+  return 0;
+}
+
+} // namespace Wall
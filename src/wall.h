@@ -0,0 +1,71 @@
+#ifndef WALL_H
+#define WALL_H
+
+#include "bot.h"
+#include "grid.h"
+#include "pool.h"
+#include "render.h"
+#include "state.h"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+// Several boards in one window: local versus, two players on one keyboard,
+// or a wall of up to MAX_BOARDS boards played by bots. Cleared lines send
+// garbage to the next board.
+namespace Wall {
+
+constexpr int MAX_BOARDS = 100;
+constexpr int MAX_PLAYERS = 2;
+// A lost board starts again after that many steps
+constexpr int RESTART_STEPS = 60;
+
+struct T {
+  Pool::T pool;
+  // On the keyboard, the first boards, the others are played by bots
+  int players = 0;
+  // As received from the window, used to ignore the OS key repeat
+  std::bitset<sf::Keyboard::KeyCount> held;
+  // Soft drop keys held by each player
+  std::array<bool, MAX_PLAYERS> softDropping = {};
+  // Left and right repeat while held like in State, the soft drop factor is
+  // the one of the pool
+  State::Handling handling;
+  // -1 while a player holds left, +1 for right, 0 otherwise
+  std::array<int, MAX_PLAYERS> shiftDirection = {};
+  std::array<sf::Time, MAX_PLAYERS> shiftPressedAt = {};
+  std::array<int, MAX_PLAYERS> shiftRepeats = {};
+  // Advanced by every step
+  sf::Time time = sf::Time::Zero;
+
+  // Of each board, what is left of the move of its bot for the current piece
+  std::vector<Bot::Move> plans;
+  std::vector<std::int32_t> plannedPieces;
+  std::vector<std::uint16_t> lostSteps;
+  int games = 0;
+
+  // Layout, the grid of each board
+  std::vector<Grid::T> grids;
+  std::vector<sf::Vector2f> origins;
+  float size = 0.f;
+};
+
+// `boards` boards laid out in a window of `area` pixels
+T init(int boards, int players, unsigned int seed, sf::Vector2f area);
+
+void handleEvent(T &t, const sf::Event &event);
+
+// The players and the bots choose the input of their boards, then they all
+// step together
+void step(T &t);
+
+void draw(const T &t, Render::T &target);
+
+// Opens a window and plays until it is closed
+int run(int boards, int players, State::Handling handling);
+
+} // namespace Wall
+
+#endif // !WALL_H